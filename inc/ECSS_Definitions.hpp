@@ -59,6 +59,22 @@ inline const uint16_t ECSSMaxStringSize = 256U;
  */
 inline const uint16_t ECSSMaxFixedOctetStringSize = 256U;
 
+/**
+ * The maximum size of a large packet that is reassembled from ST[13] \ref LargePacketTransferService uplink parts, in
+ * bytes
+ */
+inline const uint16_t ECSSMaxLargePacketSize = 4096U;
+
+/**
+ * The number of large packets that ST[13] \ref LargePacketTransferService can reassemble at the same time
+ */
+inline const uint8_t ECSSMaxLargePacketTransactions = 2;
+
+/**
+ * The time after which a ST[13] uplink transaction that has not received any part is abandoned, in seconds
+ */
+inline constexpr std::chrono::duration<uint16_t> ECSSLargePacketReassemblyTimeout(60);
+
 /**
  * The total number of different message types that can be handled by this project
  */
@@ -100,7 +116,36 @@ inline const uint8_t ECSSTCRequestStringSize = 64;
  * The maximum number of activities that can be in the time-based schedule
  * @see TimeBasedSchedulingService
  */
-inline const uint8_t ECSSMaxNumberOfTimeSchedActivities = 10;
+inline const uint16_t ECSSMaxNumberOfTimeSchedActivities = 10;
+
+/**
+ * The size in bytes of the memory that holds the requests of the time-based schedule. Each request takes its length
+ * without any trailing zeros, plus 3 bytes. The default fits a full-size request for every activity, but it can be
+ * smaller than that if the scheduled requests are usually short.
+ * @see TimeBasedSchedulingService
+ */
+inline const uint32_t ECSSTimeSchedRequestArenaSize = ECSSMaxNumberOfTimeSchedActivities * (ECSSTCRequestStringSize + 3U);
+static_assert(ECSSTimeSchedRequestArenaSize == static_cast<uint64_t>(ECSSMaxNumberOfTimeSchedActivities) * (ECSSTCRequestStringSize + 3U),
+              "The size of the time-based schedule request arena must fit in 32 bits");
+
+/**
+ * The maximum number of due activities that the time-based schedule releases in one call, which bounds the time spent
+ * executing requests in a single scheduling cycle
+ * @see TimeBasedSchedulingService::executeScheduledActivities
+ */
+inline const uint16_t ECSSTimeSchedReleaseBudget = 8;
+
+/**
+ * The number of sub-schedules of the time-based schedule, identified from 0 to ECSSMaxNumberOfTimeSchedSubSchedules - 1
+ * @see TimeBasedSchedulingService
+ */
+inline const uint8_t ECSSMaxNumberOfTimeSchedSubSchedules = 4;
+
+/**
+ * The number of scheduling groups of the time-based schedule, identified from 0 to ECSSMaxNumberOfTimeSchedGroups - 1
+ * @see TimeBasedSchedulingService
+ */
+inline const uint8_t ECSSMaxNumberOfTimeSchedGroups = 8;
 
 /**
  * @brief Time margin used in the time based command scheduling service ST[11]
@@ -117,11 +162,23 @@ inline constexpr std::chrono::duration<uint8_t> ECSSTimeMarginForActivation(60);
 inline const uint8_t ECSSEventDataAuxiliaryMaxSize = 64;
 
 /**
- * @brief Size of the multimap that holds every event-action definition
+ * @brief Maximum number of raised events that wait to be reported. Must be a power of two.
+ * @see EventReportService::raiseEvent
+ */
+inline const uint8_t ECSSRaisedEventQueueSize = 32;
+
+/**
+ * @brief Size of the map that holds every event-action definition
  * @see EventActionService
  */
 inline const uint16_t ECSSEventActionStructMapSize = 100;
 
+/**
+ * @brief Maximum number of event-triggered actions that can wait to be executed
+ * @see EventActionService::queueAction
+ */
+inline const uint8_t ECSSEventActionQueueSize = 16;
+
 /**
  * The maximum delta between the specified release time and the actual release time
  * @see TimeBasedSchedulingService
@@ -175,6 +232,16 @@ inline const uint8_t ECSSMaxStatisticParameters = 4;
  */
 inline const bool SupportsStandardDeviation = true;
 
+/**
+ * The max number of samples that the rolling window of an ST[04] statistic can hold
+ */
+inline const uint8_t ECSSMaxStatisticWindowSize = 32;
+
+/**
+ * The number of bins of the histogram used to approximate the percentiles of an ST[04] statistic
+ */
+inline const uint8_t ECSSStatisticHistogramBins = 32;
+
 /**
  * @brief the max number of bytes allowed for a packet store to handle in ST[15].
  */
@@ -228,6 +295,22 @@ inline const uint8_t ECSSMaxServiceTypeDefinitions = 10;
 inline const uint8_t ECSSMaxApplicationsServicesCombinations = ECSSMaxControlledApplicationProcesses *
                                                                ECSSMaxServiceTypeDefinitions;
 
+/**
+ * The service types, from 0 to ECSSForwardingFilterServiceTypes - 1, and message types, from 0 to
+ * ECSSForwardingFilterMessageTypes - 1, that the compiled forwarding filter of ST[14] covers. Report types outside of
+ * them are looked up in the application process configuration instead.
+ * @see ApplicationProcessForwardingFilter
+ */
+inline const uint8_t ECSSForwardingFilterServiceTypes = 32;
+inline const uint8_t ECSSForwardingFilterMessageTypes = 64;
+
+/**
+ * The max number of report types, i.e. (service type, message type) pairs, whose forwarded and dropped reports are
+ * counted separately by ST[14]. The reports of any other report types are counted together.
+ * @see RealTimeForwardingControlService
+ */
+inline const uint8_t ECSSMaxForwardingCountedReportTypes = 32;
+
 /**
  * The max number of event definition IDs per event report blocking type definition in the event report blocking
  * configuration
@@ -235,6 +318,20 @@ inline const uint8_t ECSSMaxApplicationsServicesCombinations = ECSSMaxControlled
  */
 inline const uint8_t ECSSMaxEventDefinitionIDs = 15;
 
+/**
+ * The housekeeping parameter report structure IDs, from 0 to ECSSForwardControlHousekeepingStructures - 1, that the
+ * housekeeping parameter report forward-control configuration can hold
+ * @see RealTimeForwardingControlService
+ */
+inline const uint16_t ECSSForwardControlHousekeepingStructures = 256;
+
+/**
+ * The event definition IDs, from 0 to ECSSForwardControlEventDefinitions - 1, that the event report forward-control
+ * configuration can hold
+ * @see RealTimeForwardingControlService
+ */
+inline const uint16_t ECSSForwardControlEventDefinitions = 64;
+
 /**
  * Limits noting the minimum and maximum valid Virtual Channels used by the Storage and Retrieval subservice
  */
@@ -248,6 +345,17 @@ inline const struct {
  */
 inline const uint8_t ECSSMaxMonitoringDefinitions = 4;
 
+/**
+ * Maximum number of check transitions that are buffered before being reported in a single TM[12,12] packet.
+ */
+inline const uint8_t ECSSMaxCheckTransitionsPerReport = 8;
+
+/**
+ * The on-board parameter minimum sampling interval, in milliseconds. It is the unit of the ST[12] maximum transition
+ * reporting delay.
+ */
+inline const uint16_t ECSSMinimumSamplingIntervalMs = 100;
+
 /**
  * 6.18.2.2 The applicationId that is assigned on the specific device that runs these Services.
  * In the ECSS-E-ST-70-41C the application ID is also referred as application process.
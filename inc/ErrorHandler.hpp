@@ -403,6 +403,54 @@ public:
 		 * A file type that was expected to be a directory is a file instead
 		 */
 		RepositoryPathLeadsToFile = 62,
+		/**
+		 * Attempt to set the rolling window of a statistic to more samples than ECSSMaxStatisticWindowSize (ST[04])
+		 */
+		InvalidStatisticWindowSize = 63,
+		/**
+		 * Attempt to set the histogram range of a statistic, but the high limit is lower than the low limit (ST[04])
+		 */
+		InvalidStatisticHistogramRange = 64,
+		/**
+		 * Attempt to add or modify a parameter monitoring definition with an unknown check type (ST[12])
+		 */
+		InvalidParameterMonitoringCheckType = 65,
+		/**
+		 * Attempt to add a housekeeping structure or event definition ID that its forward-control configuration cannot
+		 * hold (ST[14])
+		 */
+		InvalidForwardControlDefinition = 66,
+		/**
+		 * Attempt to delete a housekeeping structure or event definition ID that is not in its forward-control
+		 * configuration (ST[14])
+		 */
+		NonExistentForwardControlDefinition = 67,
+		/**
+		 * Attempt to read the content of a file, starting after the end of the file (ST[23])
+		 */
+		FileOffsetIsOutOfBounds = 68,
+		/**
+		 * Attempt to transfer a file to a packet store that does not have room for all of its content (ST[23])
+		 */
+		PacketStoreCannotHoldFile = 69,
+		/**
+		 * A large packet uplink part does not fit its transaction, because of its size, its part sequence number or
+		 * its type (ST[13])
+		 */
+		InvalidLargePacketPart = 70,
+		/**
+		 * A large packet uplink part starts a new transaction, but all the reassembly transactions are in use (ST[13])
+		 */
+		MaxLargePacketTransactionsReached = 71,
+		/**
+		 * Attempt to add or modify a parameter monitoring definition that raises an event that does not exist
+		 * (ST[12])
+		 */
+		InvalidParameterMonitoringEventDefinition = 72,
+		/**
+		 * Attempt to transfer a file to a packet store whose storage status is disabled (ST[23])
+		 */
+		PacketStoreStorageIsDisabled = 73,
 	};
 
 	/**
@@ -455,6 +503,23 @@ public:
 		 * A report file attributes command was requested on a directory
 		 */
 		AttemptedReportAttributesOnDirectory = 8,
+		/**
+		 * A write file content command was requested on a file that is locked
+		 */
+		AttemptedWriteOnLockedFile = 9,
+		/**
+		 * A read or write file content command was requested on a directory
+		 */
+		AttemptedContentAccessOnDirectory = 10,
+		/**
+		 * A directory summary command was requested on a file
+		 */
+		AttemptedSummaryOfFile = 11,
+		/**
+		 * A large packet was reassembled from its ST[13] uplink parts, but the platform could not use it, e.g. because
+		 * it is too large to be executed
+		 */
+		LargePacketNotAccepted = 12,
 	};
 
 	/**
@@ -1,4 +1,9 @@
 #pragma once
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include "ECSS_Definitions.hpp"
 #include "Services/EventActionService.hpp"
 #include "Services/EventReportService.hpp"
 #include "Services/HousekeepingService.hpp"
@@ -6,36 +11,217 @@
 #include "Services/MemoryManagementService.hpp"
 #include "Services/ParameterService.hpp"
 #include "Services/ParameterStatisticsService.hpp"
-#include "Services/RealTimeForwardingControlService.hpp"
 #include "Services/RequestVerificationService.hpp"
 #include "Services/TestService.hpp"
 #include "Services/TimeBasedSchedulingService.hpp"
+#include "etl/array.h"
 
 /**
  * Namespace containing all the report types for every service type.
  * For use in ST[14] and ST[15]
+ *
+ * The tables are built at compile time, so they take no static initialisation and live in read-only memory.
  */
 namespace AllReportTypes {
 	typedef uint8_t ReportId;
+
+	/**
+	 * The report types of a service, as a bitset of their message types. Iterating over it visits the message types
+	 * in ascending order.
+	 */
+	class ServiceReportTypes {
+		uint64_t messageTypes = 0;
+
+	public:
+		/**
+		 * Visits the message types of a ServiceReportTypes
+		 */
+		class Iterator {
+			uint64_t remainingMessageTypes;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = ReportId;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const ReportId*;
+			using reference = ReportId;
+
+			constexpr explicit Iterator(uint64_t messageTypes) : remainingMessageTypes(messageTypes) {}
+
+			constexpr ReportId operator*() const {
+				ReportId messageType = 0;
+				while (((remainingMessageTypes >> messageType) & 1U) == 0) {
+					messageType++;
+				}
+				return messageType;
+			}
+
+			constexpr Iterator& operator++() {
+				remainingMessageTypes &= remainingMessageTypes - 1;
+				return *this;
+			}
+
+			constexpr Iterator operator++(int) {
+				Iterator previous = *this;
+				++*this;
+				return previous;
+			}
+
+			constexpr bool operator==(const Iterator& other) const {
+				return remainingMessageTypes == other.remainingMessageTypes;
+			}
+
+			constexpr bool operator!=(const Iterator& other) const {
+				return remainingMessageTypes != other.remainingMessageTypes;
+			}
+		};
+
+		constexpr ServiceReportTypes() = default;
+
+		/**
+		 * @param reports The message types of the reports, which must be lower than 64
+		 */
+		constexpr ServiceReportTypes(std::initializer_list<ReportId> reports) {
+			for (const ReportId report: reports) {
+				messageTypes |= uint64_t{1} << report;
+			}
+		}
+
+		/**
+		 * @return The message types as a bitset, where bit N is set for message type N
+		 */
+		constexpr uint64_t bits() const {
+			return messageTypes;
+		}
+
+		constexpr bool contains(MessageTypeNum messageType) const {
+			return messageType < 64 and ((messageTypes >> messageType) & 1U) != 0;
+		}
+
+		constexpr size_t size() const {
+			size_t count = 0;
+			for (uint64_t remaining = messageTypes; remaining != 0; remaining &= remaining - 1) {
+				count++;
+			}
+			return count;
+		}
+
+		constexpr bool empty() const {
+			return messageTypes == 0;
+		}
+
+		constexpr Iterator begin() const {
+			return Iterator(messageTypes);
+		}
+
+		constexpr Iterator end() const {
+			return Iterator(0);
+		}
+	};
+
 	/**
-	 * Vector to contain all report types defined for a service
+	 * Table of all the report types, indexed by the service type, from 0 to ECSSForwardingFilterServiceTypes - 1
 	 */
-	using ServiceDefinitionsVector = etl::vector<ReportId, ECSSMaxReportTypeDefinitions>;
-	const extern ServiceDefinitionsVector ST01Reports;
-	const extern ServiceDefinitionsVector ST03Reports;
-	const extern ServiceDefinitionsVector ST04Reports;
-	const extern ServiceDefinitionsVector ST05Reports;
-	const extern ServiceDefinitionsVector ST06Reports;
-	const extern ServiceDefinitionsVector ST11Reports;
-	const extern ServiceDefinitionsVector ST13Reports;
-	const extern ServiceDefinitionsVector ST17Reports;
-	const extern ServiceDefinitionsVector ST19Reports;
-	const extern ServiceDefinitionsVector ST20Reports;
+	class ReportTypesOfServices {
+		etl::array<ServiceReportTypes, ECSSForwardingFilterServiceTypes> reportsOfService{};
+
+		/**
+		 * The report types of the service types beyond the table
+		 */
+		static constexpr ServiceReportTypes NoReports{};
+
+	public:
+		/**
+		 * @param services Pairs of a service type and its report types
+		 */
+		constexpr ReportTypesOfServices(std::initializer_list<std::pair<ServiceTypeNum, ServiceReportTypes>> services) {
+			for (const auto& service: services) {
+				reportsOfService[service.first] = service.second;
+			}
+		}
+
+		/**
+		 * @return The report types of a service, which are empty for services without any reports, and for service types
+		 * that do not fit in the table
+		 */
+		constexpr const ServiceReportTypes& at(ServiceTypeNum serviceType) const {
+			if (serviceType >= ECSSForwardingFilterServiceTypes) {
+				return NoReports;
+			}
+			return reportsOfService[serviceType];
+		}
+
+		/**
+		 * Calls a function for every service type that has report types, as `function(ServiceTypeNum)`
+		 */
+		template <class Function>
+		void forEachService(Function&& function) const {
+			for (ServiceTypeNum serviceType = 0; serviceType < ECSSForwardingFilterServiceTypes; serviceType++) {
+				if (not reportsOfService[serviceType].empty()) {
+					function(serviceType);
+				}
+			}
+		}
+	};
+
+	inline constexpr ServiceReportTypes ST01Reports = {RequestVerificationService::MessageType::FailedAcceptanceReport,
+	                                                   RequestVerificationService::MessageType::FailedCompletionOfExecution,
+	                                                   RequestVerificationService::MessageType::FailedProgressOfExecution,
+	                                                   RequestVerificationService::MessageType::FailedRoutingReport,
+	                                                   RequestVerificationService::MessageType::FailedStartOfExecution,
+	                                                   RequestVerificationService::MessageType::SuccessfulAcceptanceReport,
+	                                                   RequestVerificationService::MessageType::SuccessfulCompletionOfExecution,
+	                                                   RequestVerificationService::MessageType::SuccessfulProgressOfExecution,
+	                                                   RequestVerificationService::MessageType::SuccessfulStartOfExecution};
+
+	inline constexpr ServiceReportTypes ST03Reports = {
+	    HousekeepingService::MessageType::DisablePeriodicHousekeepingParametersReport,
+	    HousekeepingService::MessageType::EnablePeriodicHousekeepingParametersReport,
+	    HousekeepingService::MessageType::GenerateOneShotHousekeepingReport,
+	    HousekeepingService::MessageType::HousekeepingParametersReport,
+	    HousekeepingService::MessageType::HousekeepingPeriodicPropertiesReport,
+	    HousekeepingService::MessageType::HousekeepingStructuresReport};
+
+	inline constexpr ServiceReportTypes ST04Reports = {
+	    ParameterStatisticsService::MessageType::ParameterStatisticsDefinitionsReport,
+	    ParameterStatisticsService::MessageType::ParameterStatisticsReport,
+	};
+
+	inline constexpr ServiceReportTypes ST05Reports = {EventReportService::MessageType::HighSeverityAnomalyReport,
+	                                                   EventReportService::MessageType::DisabledListEventReport,
+	                                                   EventReportService::MessageType::InformativeEventReport,
+	                                                   EventReportService::MessageType::LowSeverityAnomalyReport,
+	                                                   EventReportService::MessageType::MediumSeverityAnomalyReport};
+
+	inline constexpr ServiceReportTypes ST06Reports = {MemoryManagementService::MessageType::CheckRawMemoryDataReport,
+	                                                   MemoryManagementService::MessageType::DumpRawMemoryDataReport};
+
+	inline constexpr ServiceReportTypes ST11Reports = {TimeBasedSchedulingService::MessageType::TimeBasedScheduledSummaryReport};
+
+	inline constexpr ServiceReportTypes ST13Reports = {LargePacketTransferService::MessageType::FirstDownlinkPartReport,
+	                                                   LargePacketTransferService::MessageType::InternalDownlinkPartReport,
+	                                                   LargePacketTransferService::MessageType::LastDownlinkPartReport};
+
+	inline constexpr ServiceReportTypes ST17Reports = {TestService::MessageType::AreYouAliveTestReport,
+	                                                   TestService::MessageType::OnBoardConnectionTestReport};
+
+	inline constexpr ServiceReportTypes ST19Reports = {EventActionService::MessageType::EventActionStatusReport};
+
+	inline constexpr ServiceReportTypes ST20Reports = {ParameterService::MessageType::ParameterValuesReport};
 
 	/**
-	 * Map containing all the report types, per service. The key is the ServiceType and the value,
-	 * an etl vector containing the report types.
+	 * All the report types, per service. Looking up the report types of a service is an array access.
 	 */
-	extern const etl::map<uint8_t, const ServiceDefinitionsVector&, ECSSMaxServiceTypeDefinitions> MessagesOfService;
+	inline constexpr ReportTypesOfServices MessagesOfService = {
+	    {RequestVerificationService::ServiceType, ST01Reports},
+	    {HousekeepingService::ServiceType, ST03Reports},
+	    {ParameterStatisticsService::ServiceType, ST04Reports},
+	    {EventReportService::ServiceType, ST05Reports},
+	    {MemoryManagementService::ServiceType, ST06Reports},
+	    {TimeBasedSchedulingService::ServiceType, ST11Reports},
+	    {LargePacketTransferService::ServiceType, ST13Reports},
+	    {TestService::ServiceType, ST17Reports},
+	    {EventActionService::ServiceType, ST19Reports},
+	    {ParameterService::ServiceType, ST20Reports}};
 
-} // namespace AllReportTypes
\ No newline at end of file
+} // namespace AllReportTypes
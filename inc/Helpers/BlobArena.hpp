@@ -0,0 +1,180 @@
+#ifndef ECSS_SERVICES_BLOBARENA_HPP
+#define ECSS_SERVICES_BLOBARENA_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include "etl/array.h"
+#include "etl/span.h"
+
+/**
+ * A fixed-size memory area that holds variable-length byte blobs, each one identified by a handle.
+ *
+ * The blobs are stored back to back, each one prefixed by its handle and its length, so that short blobs only take as
+ * much memory as they need. New blobs are appended at the end. Removing a blob only marks it as free, and the free
+ * space is reclaimed by moving the remaining blobs together when a new blob does not fit at the end. Since the blobs
+ * are only accessed through their handles, moving them is invisible to the users of the arena.
+ *
+ * @tparam Size The size of the arena in bytes
+ * @tparam MaxHandles The number of handles, from 0 to MaxHandles - 1
+ */
+template <size_t Size, size_t MaxHandles>
+class BlobArena {
+	static_assert(Size < UINT32_MAX, "The offsets in the arena must fit in 32 bits");
+	static_assert(MaxHandles < UINT16_MAX, "The handles must fit in 16 bits");
+
+public:
+	using Handle = uint16_t;
+
+	/**
+	 * The number of bytes that are stored in front of every blob
+	 */
+	static constexpr size_t BlobHeaderSize = 3;
+
+	/**
+	 * The maximum length of a blob
+	 */
+	static constexpr size_t MaxBlobLength = UINT8_MAX;
+
+private:
+	using Offset = uint32_t;
+
+	static constexpr Offset NoOffset = UINT32_MAX;
+	static constexpr Handle FreeBlob = UINT16_MAX;
+
+	etl::array<uint8_t, Size> bytes{};
+
+	/**
+	 * The offset of the blob of each handle, or NoOffset if the handle has no blob
+	 */
+	etl::array<Offset, MaxHandles> offsets;
+
+	/**
+	 * The offset right after the last blob
+	 */
+	size_t end = 0;
+
+	/**
+	 * The number of bytes taken by the blobs that are in use, including their headers
+	 */
+	size_t usedBytes = 0;
+
+	Handle handleAt(size_t offset) const {
+		return (bytes[offset] << 8) | bytes[offset + 1];
+	}
+
+	void setHandleAt(size_t offset, Handle handle) {
+		bytes[offset] = handle >> 8;
+		bytes[offset + 1] = handle & 0xFF;
+	}
+
+	size_t lengthAt(size_t offset) const {
+		return bytes[offset + 2];
+	}
+
+	/**
+	 * Moves all the blobs in use to the start of the arena, to join all the free space at the end.
+	 */
+	void compact() {
+		size_t destination = 0;
+		for (size_t source = 0; source < end; source += BlobHeaderSize + lengthAt(source)) {
+			const size_t blobSize = BlobHeaderSize + lengthAt(source);
+			const Handle handle = handleAt(source);
+			if (handle == FreeBlob) {
+				continue;
+			}
+			if (destination != source) {
+				std::copy(bytes.begin() + source, bytes.begin() + source + blobSize, bytes.begin() + destination);
+				offsets[handle] = destination;
+			}
+			destination += blobSize;
+		}
+		end = destination;
+	}
+
+public:
+	BlobArena() {
+		clear();
+	}
+
+	/**
+	 * Removes all the blobs.
+	 */
+	void clear() {
+		offsets.fill(NoOffset);
+		end = 0;
+		usedBytes = 0;
+	}
+
+	/**
+	 * @return Whether a blob of this length can be stored, possibly after moving the existing blobs together
+	 */
+	bool canStore(size_t length) const {
+		return length <= MaxBlobLength and usedBytes + BlobHeaderSize + length <= Size;
+	}
+
+	/**
+	 * Stores a blob for a handle that does not have one.
+	 *
+	 * @return False if there is not enough space for the blob
+	 */
+	bool store(Handle handle, const uint8_t* data, size_t length) {
+		if (not canStore(length) or offsets[handle] != NoOffset) {
+			return false;
+		}
+		if (end + BlobHeaderSize + length > Size) {
+			compact();
+		}
+
+		setHandleAt(end, handle);
+		bytes[end + 2] = length;
+		std::copy(data, data + length, bytes.begin() + end + BlobHeaderSize);
+		offsets[handle] = end;
+
+		end += BlobHeaderSize + length;
+		usedBytes += BlobHeaderSize + length;
+		return true;
+	}
+
+	/**
+	 * Removes the blob of a handle, if it has one.
+	 */
+	void release(Handle handle) {
+		const Offset offset = offsets[handle];
+		if (offset == NoOffset) {
+			return;
+		}
+		setHandleAt(offset, FreeBlob);
+		offsets[handle] = NoOffset;
+		usedBytes -= BlobHeaderSize + lengthAt(offset);
+
+		// Reclaim the space immediately if the blob was the last one
+		if (offset + BlobHeaderSize + lengthAt(offset) == end) {
+			end = offset;
+		}
+	}
+
+	/**
+	 * @return The blob of a handle, which is empty if the handle has no blob. It is only valid until the next call to
+	 * store().
+	 */
+	etl::span<const uint8_t> get(Handle handle) const {
+		const Offset offset = offsets[handle];
+		if (offset == NoOffset) {
+			return {};
+		}
+		return {bytes.data() + offset + BlobHeaderSize, lengthAt(offset)};
+	}
+
+	/**
+	 * @return The number of bytes taken by the blobs, including their headers
+	 */
+	size_t used() const {
+		return usedBytes;
+	}
+
+	static constexpr size_t capacity() {
+		return Size;
+	}
+};
+
+#endif // ECSS_SERVICES_BLOBARENA_HPP
@@ -0,0 +1,201 @@
+#ifndef ECSS_SERVICES_EVENTINDEXEDMAP_HPP
+#define ECSS_SERVICES_EVENTINDEXEDMAP_HPP
+
+#include <cstdint>
+#include <utility>
+#include "Helpers/TypeDefinitions.hpp"
+#include "etl/array.h"
+#include "etl/vector.h"
+
+/**
+ * A fixed-capacity map from event definition IDs to definitions, with O(1) average lookup, insertion and removal.
+ *
+ * The definitions are stored contiguously, so that iterating over them is as cheap as iterating over an array. An
+ * open-addressing index with linear probing maps each event definition ID to the position of its definition. Since
+ * event definition IDs are usually small and consecutive, the ID itself is used as the hash.
+ *
+ * Removing a definition moves the last one in its place, so the iteration order is the insertion order only as long
+ * as no definition has been removed.
+ *
+ * The interface follows the subset of etl::map that is needed by the services, so that it can be used in its place.
+ *
+ * @tparam T The type of the definitions
+ * @tparam Capacity The maximum number of definitions
+ */
+template <typename T, size_t Capacity>
+class EventIndexedMap {
+public:
+	using value_type = std::pair<EventDefinitionId, T>;
+	using iterator = typename etl::vector<value_type, Capacity>::iterator;
+	using const_iterator = typename etl::vector<value_type, Capacity>::const_iterator;
+
+private:
+	/**
+	 * The number of entries of the index. It is the smallest power of two that is at least twice the capacity, so
+	 * that the index is at most half full and probe sequences stay short.
+	 */
+	static constexpr size_t IndexSize = [] {
+		size_t size = 1;
+		while (size < 2 * Capacity) {
+			size *= 2;
+		}
+		return size;
+	}();
+	static constexpr size_t IndexMask = IndexSize - 1;
+
+	/**
+	 * Marks an unused entry of the index
+	 */
+	static constexpr uint16_t EmptyIndexEntry = 0;
+
+	etl::vector<value_type, Capacity> definitions;
+
+	/**
+	 * For each entry, the position of the definition in the definitions vector plus one, or EmptyIndexEntry
+	 */
+	etl::array<uint16_t, IndexSize> index{};
+
+	static size_t homePosition(EventDefinitionId eventDefinitionID) {
+		return eventDefinitionID & IndexMask;
+	}
+
+	/**
+	 * @return The index entry of an event definition ID, or the empty entry where it would be inserted
+	 */
+	size_t findIndexPosition(EventDefinitionId eventDefinitionID) const {
+		size_t position = homePosition(eventDefinitionID);
+		while (index[position] != EmptyIndexEntry and definitions[index[position] - 1].first != eventDefinitionID) {
+			position = (position + 1) & IndexMask;
+		}
+		return position;
+	}
+
+	/**
+	 * Empties an entry of the index, and moves back the following entries of the probe sequence, so that no
+	 * tombstones are needed.
+	 */
+	void removeIndexEntry(size_t hole) {
+		index[hole] = EmptyIndexEntry;
+		for (size_t next = (hole + 1) & IndexMask; index[next] != EmptyIndexEntry; next = (next + 1) & IndexMask) {
+			const size_t home = homePosition(definitions[index[next] - 1].first);
+			if (((next - home) & IndexMask) >= ((next - hole) & IndexMask)) {
+				index[hole] = index[next];
+				index[next] = EmptyIndexEntry;
+				hole = next;
+			}
+		}
+	}
+
+public:
+	iterator begin() {
+		return definitions.begin();
+	}
+
+	iterator end() {
+		return definitions.end();
+	}
+
+	const_iterator begin() const {
+		return definitions.begin();
+	}
+
+	const_iterator end() const {
+		return definitions.end();
+	}
+
+	size_t size() const {
+		return definitions.size();
+	}
+
+	bool empty() const {
+		return definitions.empty();
+	}
+
+	bool full() const {
+		return definitions.full();
+	}
+
+	iterator find(EventDefinitionId eventDefinitionID) {
+		const size_t position = findIndexPosition(eventDefinitionID);
+		if (index[position] == EmptyIndexEntry) {
+			return end();
+		}
+		return begin() + (index[position] - 1);
+	}
+
+	const_iterator find(EventDefinitionId eventDefinitionID) const {
+		const size_t position = findIndexPosition(eventDefinitionID);
+		if (index[position] == EmptyIndexEntry) {
+			return end();
+		}
+		return begin() + (index[position] - 1);
+	}
+
+	size_t count(EventDefinitionId eventDefinitionID) const {
+		return (find(eventDefinitionID) == end()) ? 0 : 1;
+	}
+
+	std::pair<iterator, iterator> equal_range(EventDefinitionId eventDefinitionID) {
+		iterator element = find(eventDefinitionID);
+		if (element == end()) {
+			return {end(), end()};
+		}
+		return {element, element + 1};
+	}
+
+	/**
+	 * Adds a definition, unless a definition for the same event definition ID already exists or the map is full.
+	 *
+	 * @return The position of the definition with this ID, and whether the new definition was inserted
+	 */
+	std::pair<iterator, bool> insert(const value_type& value) {
+		const size_t position = findIndexPosition(value.first);
+		if (index[position] != EmptyIndexEntry) {
+			return {begin() + (index[position] - 1), false};
+		}
+		if (definitions.full()) {
+			return {end(), false};
+		}
+
+		definitions.push_back(value);
+		index[position] = definitions.size();
+		return {end() - 1, true};
+	}
+
+	/**
+	 * Removes a definition, by moving the last definition in its place.
+	 *
+	 * @return An iterator to the definition that took the place of the removed one
+	 */
+	iterator erase(iterator element) {
+		const size_t slot = element - begin();
+		removeIndexEntry(findIndexPosition(element->first));
+
+		const size_t lastSlot = definitions.size() - 1;
+		if (slot != lastSlot) {
+			index[findIndexPosition(definitions[lastSlot].first)] = slot + 1;
+			definitions[slot] = definitions[lastSlot];
+		}
+		definitions.pop_back();
+		return begin() + slot;
+	}
+
+	/**
+	 * @return The number of removed definitions
+	 */
+	size_t erase(EventDefinitionId eventDefinitionID) {
+		iterator element = find(eventDefinitionID);
+		if (element == end()) {
+			return 0;
+		}
+		erase(element);
+		return 1;
+	}
+
+	void clear() {
+		definitions.clear();
+		index.fill(EmptyIndexEntry);
+	}
+};
+
+#endif // ECSS_SERVICES_EVENTINDEXEDMAP_HPP
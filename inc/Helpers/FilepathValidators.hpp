@@ -4,6 +4,7 @@
 #include <etl/optional.h>
 #include "Services/FileManagementService.hpp"
 #include "etl/String.hpp"
+#include "etl/string_view.h"
 
 namespace FilepathValidators {
 	/**
@@ -12,4 +13,13 @@ namespace FilepathValidators {
      * @return Optionally, the position of the wildcard.
      */
 	etl::optional<size_t> findWildcardPosition(const Filesystem::Path& path);
+
+	/**
+	 * Checks whether a path matches a search pattern. Each wildcard in the pattern matches any sequence of characters,
+	 * including '/', so that a pattern can match objects at any depth. Every other character matches only itself.
+	 * @param pattern The search pattern
+	 * @param path The path to check
+	 * @return True if the whole path matches the whole pattern
+	 */
+	bool matchesWildcardPattern(etl::string_view pattern, etl::string_view path);
 } //namespace FilepathValidators
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <functional>
 #include "ECSS_Definitions.hpp"
 #include "etl/String.hpp"
 #include "etl/optional.h"
 #include "etl/result.h"
+#include "etl/span.h"
+#include "etl/string_view.h"
 
 namespace Filesystem {
 	constexpr size_t FullPathSize = ECSSMaxStringSize;
@@ -83,6 +86,45 @@ namespace Filesystem {
 		FileDoesNotExist = 1
 	};
 
+	/**
+	 * Possible errors returned by the filesystem while reading the content of a file
+	 */
+	enum class FileReadError : uint8_t {
+		FileDoesNotExist = 0,
+		PathLeadsToDirectory = 1,
+		UnknownError = 255
+	};
+
+	/**
+	 * Possible errors returned by the filesystem while writing the content of a file
+	 */
+	enum class FileWriteError : uint8_t {
+		FileDoesNotExist = 0,
+		PathLeadsToDirectory = 1,
+		FileIsLocked = 2,
+		UnknownError = 255
+	};
+
+	/**
+	 * Possible errors returned by the filesystem while reading the entries of a directory
+	 */
+	enum class DirectoryReadError : uint8_t {
+		DirectoryDoesNotExist = 0,
+		PathLeadsToFile = 1,
+		UnknownError = 255
+	};
+
+	/**
+	 * A file or directory inside a directory
+	 */
+	struct DirectoryEntry {
+		NodeType type;
+		/**
+		 * The name of the object, without the path of its directory. It is only valid while the entry is visited.
+		 */
+		etl::string_view name;
+	};
+
 	/**
 	 * Creates a file using platform specific filesystem functions
 	 * @param path A String representing the path on the filesystem
@@ -97,6 +139,36 @@ namespace Filesystem {
 	 */
 	etl::optional<FileDeletionError> deleteFile(const Path& path);
 
+	/**
+	 * Reads part of the content of a file, straight into the provided buffer
+	 * @param path A String representing the path on the filesystem
+	 * @param offset The position in the file of the first byte to read
+	 * @param buffer The buffer to read into. At most buffer.size() bytes are read.
+	 * @return Either the number of bytes read, which is less than the buffer size only at the end of the file, either
+	 * a FileReadError
+	 */
+	etl::result<size_t, FileReadError> readFile(const Path& path, size_t offset, etl::span<uint8_t> buffer);
+
+	/**
+	 * Writes data to an existing file, extending the file if the data ends after the end of the file
+	 * @param path A String representing the path on the filesystem
+	 * @param offset The position in the file of the first byte to write
+	 * @param data The bytes to write
+	 * @return Optionally, a file write error. If no errors occur, returns etl::nullopt
+	 */
+	etl::optional<FileWriteError> writeFile(const Path& path, size_t offset, etl::span<const uint8_t> data);
+
+	/**
+	 * Visits the files and directories inside a directory, in no particular order and without entering its
+	 * subdirectories. Only the current entry is held in memory, so the memory used does not depend on the size of the
+	 * directory.
+	 * @param path A String representing the path on the filesystem
+	 * @param visitor Called with each entry, as `visitor(entry)`. Returning false stops the iteration.
+	 * @return Optionally, a directory read error. If no errors occur, returns etl::nullopt
+	 */
+	etl::optional<DirectoryReadError> forEachDirectoryEntry(const Path& path,
+	                                                        const std::function<bool(const DirectoryEntry&)>& visitor);
+
 	/**
 	 * Creates a directory using platform specific filesystem functions
 	 * @param path A String representing the path on the filesystem
@@ -1,9 +1,12 @@
 #ifndef ECSS_SERVICES_FORWARDCONTROLCONFIGURATION_HPP
 #define ECSS_SERVICES_FORWARDCONTROLCONFIGURATION_HPP
 
+#include <algorithm>
 #include "ECSS_Definitions.hpp"
 #include "ErrorHandler.hpp"
 #include "Helpers/Parameter.hpp"
+#include "etl/array.h"
+#include "etl/bitset.h"
 #include "etl/map.h"
 #include "etl/vector.h"
 
@@ -45,4 +48,232 @@ public:
 	ApplicationProcessConfiguration() = default;
 };
 
+/**
+ * The application process configuration, compiled into a bitset so that deciding whether a report is forwarded takes
+ * a couple of loads instead of searching the configuration. Each controlled application process has a slot, and each
+ * (slot, service type) pair has a word with one bit per message type.
+ *
+ * The filter does not follow the changes of the configuration, so it has to be rebuilt after every change.
+ */
+class ApplicationProcessForwardingFilter {
+	static_assert(ECSSForwardingFilterMessageTypes <= 64, "The message types of a service must fit in a 64-bit word");
+
+	/**
+	 * The controlled application processes, in the order of their slots
+	 */
+	etl::vector<ApplicationProcessId, ECSSMaxControlledApplicationProcesses> applications;
+
+	/**
+	 * The forwarded message types of each (slot, service type) pair
+	 */
+	etl::array<uint64_t, ECSSMaxControlledApplicationProcesses * ECSSForwardingFilterServiceTypes> messageTypeWords{};
+
+public:
+	/**
+	 * @return Whether the filter covers a report type. Report types that are not covered are never forwarded by the
+	 * filter.
+	 */
+	static bool covers(ServiceTypeNum serviceType, MessageTypeNum messageType) {
+		return serviceType < ECSSForwardingFilterServiceTypes and messageType < ECSSForwardingFilterMessageTypes;
+	}
+
+	/**
+	 * @return Whether a report type of an application process is in the configuration that the filter was built from
+	 */
+	bool isForwarded(ApplicationProcessId applicationID, ServiceTypeNum serviceType, MessageTypeNum messageType) const {
+		if (not covers(serviceType, messageType)) {
+			return false;
+		}
+		for (size_t slot = 0; slot < applications.size(); slot++) {
+			if (applications[slot] == applicationID) {
+				return ((messageTypeWords[slot * ECSSForwardingFilterServiceTypes + serviceType] >> messageType) & 1U) != 0;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Compiles the report types of the controlled application processes from a configuration
+	 */
+	void rebuild(const etl::ivector<ApplicationProcessId>& controlledApplications,
+	             const ApplicationProcessConfiguration& configuration) {
+		applications.assign(controlledApplications.begin(), controlledApplications.end());
+		messageTypeWords.fill(0);
+
+		for (const auto& definition: configuration.definitions) {
+			const auto application = std::find(applications.begin(), applications.end(), definition.first.first);
+			if (application == applications.end()) {
+				continue;
+			}
+			const size_t slot = application - applications.begin();
+			const ServiceTypeNum serviceType = definition.first.second;
+			for (const MessageTypeNum messageType: definition.second) {
+				if (covers(serviceType, messageType)) {
+					messageTypeWords[slot * ECSSForwardingFilterServiceTypes + serviceType] |= uint64_t{1} << messageType;
+				}
+			}
+		}
+	}
+};
+
+/**
+ * A forward-control configuration of ST[14] that is keyed by an identifier of the reports, i.e. the housekeeping
+ * parameter report configuration, keyed by structure ID, or the event report configuration, keyed by event definition
+ * ID. Each application process in the configuration has a bitset of its enabled identifiers, so checking a report
+ * takes O(1), after finding the application process among at most ECSSMaxControlledApplicationProcesses.
+ *
+ * @tparam Identifier The type of the identifiers
+ * @tparam Identifiers The number of identifiers that the configuration can hold, from 0 to Identifiers - 1
+ */
+template <typename Identifier, size_t Identifiers>
+class IdentifierForwardControlConfiguration {
+public:
+	using IdentifierType = Identifier;
+	using IdentifierSet = etl::bitset<Identifiers>;
+
+private:
+	etl::vector<ApplicationProcessId, ECSSMaxControlledApplicationProcesses> applications;
+	etl::array<IdentifierSet, ECSSMaxControlledApplicationProcesses> enabledIdentifiers;
+
+	/**
+	 * @return The slot of an application process, or the number of application processes if it is not in the
+	 * configuration
+	 */
+	size_t slotOf(ApplicationProcessId applicationID) const {
+		return std::find(applications.begin(), applications.end(), applicationID) - applications.begin();
+	}
+
+	/**
+	 * @return The slot of an application process, which is added without any identifiers if it is not in the
+	 * configuration, or the number of application processes if there is no room for it
+	 */
+	size_t findOrAddSlot(ApplicationProcessId applicationID) {
+		const size_t slot = slotOf(applicationID);
+		if (slot == applications.size() and not applications.full()) {
+			applications.push_back(applicationID);
+			enabledIdentifiers[slot].reset();
+		}
+		return slot;
+	}
+
+	void removeSlot(size_t slot) {
+		applications[slot] = applications.back();
+		enabledIdentifiers[slot] = enabledIdentifiers[applications.size() - 1];
+		applications.pop_back();
+	}
+
+public:
+	static bool isValid(Identifier identifier) {
+		return identifier < Identifiers;
+	}
+
+	/**
+	 * @return Whether the reports with an identifier, generated by an application process, are forwarded
+	 */
+	bool isEnabled(ApplicationProcessId applicationID, Identifier identifier) const {
+		const size_t slot = slotOf(applicationID);
+		return slot < applications.size() and isValid(identifier) and enabledIdentifiers[slot].test(identifier);
+	}
+
+	bool containsApplication(ApplicationProcessId applicationID) const {
+		return slotOf(applicationID) < applications.size();
+	}
+
+	/**
+	 * Enables an identifier, which must be valid, for an application process
+	 *
+	 * @return False if there is no room for the application process
+	 */
+	bool add(ApplicationProcessId applicationID, Identifier identifier) {
+		const size_t slot = findOrAddSlot(applicationID);
+		if (slot == applications.size()) {
+			return false;
+		}
+		enabledIdentifiers[slot].set(identifier);
+		return true;
+	}
+
+	/**
+	 * Enables all the identifiers for an application process
+	 *
+	 * @return False if there is no room for the application process
+	 */
+	bool addAll(ApplicationProcessId applicationID) {
+		const size_t slot = findOrAddSlot(applicationID);
+		if (slot == applications.size()) {
+			return false;
+		}
+		enabledIdentifiers[slot].set();
+		return true;
+	}
+
+	/**
+	 * Disables an identifier for an application process, which is removed from the configuration if it has no other
+	 * identifiers.
+	 *
+	 * @return False if the identifier is not enabled for the application process
+	 */
+	bool remove(ApplicationProcessId applicationID, Identifier identifier) {
+		const size_t slot = slotOf(applicationID);
+		if (slot == applications.size() or not isValid(identifier) or not enabledIdentifiers[slot].test(identifier)) {
+			return false;
+		}
+		enabledIdentifiers[slot].reset(identifier);
+		if (enabledIdentifiers[slot].none()) {
+			removeSlot(slot);
+		}
+		return true;
+	}
+
+	/**
+	 * Removes an application process and all its identifiers from the configuration
+	 *
+	 * @return False if the application process is not in the configuration
+	 */
+	bool removeApplication(ApplicationProcessId applicationID) {
+		const size_t slot = slotOf(applicationID);
+		if (slot == applications.size()) {
+			return false;
+		}
+		removeSlot(slot);
+		return true;
+	}
+
+	void clear() {
+		applications.clear();
+	}
+
+	/**
+	 * @return The number of application processes in the configuration
+	 */
+	size_t size() const {
+		return applications.size();
+	}
+
+	/**
+	 * Calls a function for every application process of the configuration, as `function(ApplicationProcessId, const
+	 * IdentifierSet&)`
+	 */
+	template <class Function>
+	void forEachApplication(Function&& function) const {
+		for (size_t slot = 0; slot < applications.size(); slot++) {
+			function(applications[slot], enabledIdentifiers[slot]);
+		}
+	}
+};
+
+/**
+ * The housekeeping parameter report forward-control configuration, containing the enabled structure IDs of each
+ * application process
+ */
+using HousekeepingForwardControlConfiguration =
+    IdentifierForwardControlConfiguration<ParameterReportStructureId, ECSSForwardControlHousekeepingStructures>;
+
+/**
+ * The event report forward-control configuration, containing the enabled event definition IDs of each application
+ * process
+ */
+using EventReportForwardControlConfiguration =
+    IdentifierForwardControlConfiguration<EventDefinitionId, ECSSForwardControlEventDefinitions>;
+
 #endif
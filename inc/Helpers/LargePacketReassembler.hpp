@@ -0,0 +1,223 @@
+#ifndef ECSS_SERVICES_LARGEPACKETREASSEMBLER_HPP
+#define ECSS_SERVICES_LARGEPACKETREASSEMBLER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include "Helpers/TypeDefinitions.hpp"
+#include "Time/TimeStamp.hpp"
+#include "etl/array.h"
+#include "etl/bitset.h"
+#include "etl/span.h"
+
+/**
+ * Reassembles large packets that are uplinked in parts, as the ST[13] large packet transfer service does.
+ *
+ * Every part of a large packet, except its last part, carries exactly PartSize bytes, so part N is copied straight to
+ * offset N * PartSize of the buffer of its transaction. Parts may therefore arrive in any order, and a transaction
+ * starts with whichever of its parts arrives first. A packet is complete once its last part and all the parts before
+ * it have arrived. Transactions that receive no part for longer than a timeout are abandoned, so that a lost part
+ * does not hold a buffer forever.
+ *
+ * @tparam Transactions The number of large packets that can be reassembled at the same time
+ * @tparam MaxPacketSize The maximum size of a reassembled packet, in bytes
+ * @tparam PartSize The size of every part except the last one, in bytes
+ */
+template <size_t Transactions, size_t MaxPacketSize, size_t PartSize>
+class LargePacketReassembler {
+public:
+	/**
+	 * The maximum number of parts of a large packet
+	 */
+	static constexpr size_t MaxParts = (MaxPacketSize + PartSize - 1) / PartSize;
+
+	/**
+	 * The position of a part in its large packet, i.e. the uplink TC that carried it
+	 */
+	enum class PartType : uint8_t {
+		First = 0,
+		Intermediate = 1,
+		Last = 2
+	};
+
+	/**
+	 * The outcome of receiving a part
+	 */
+	enum class PartResult : uint8_t {
+		/**
+		 * The part was stored, and the packet is still missing parts
+		 */
+		Accepted = 0,
+		/**
+		 * The part had already been received, and was ignored
+		 */
+		Duplicate = 1,
+		/**
+		 * The part completed the packet, which has been handed over and released
+		 */
+		Completed = 2,
+		/**
+		 * The part does not fit the packet, because of its size, its sequence number or its type
+		 */
+		InvalidPart = 3,
+		/**
+		 * The part starts a new transaction, but all the transactions are in use
+		 */
+		NoFreeTransaction = 4
+	};
+
+private:
+	static_assert(MaxParts <= UINT16_MAX, "The part sequence numbers must fit in a PartSequenceNum");
+
+	static constexpr PartSequenceNum UnknownLastPart = UINT16_MAX;
+
+	struct Transaction {
+		bool inUse = false;
+		LargeMessageTransactionId identifier = 0;
+		/**
+		 * The sequence number of the last part, or UnknownLastPart until the last part arrives
+		 */
+		PartSequenceNum lastPart = UnknownLastPart;
+		/**
+		 * The highest sequence number received so far
+		 */
+		PartSequenceNum highestPart = 0;
+		size_t receivedParts = 0;
+		size_t packetSize = 0;
+		Time::DefaultCUC lastActivity;
+		etl::bitset<MaxParts> received;
+		etl::array<uint8_t, MaxPacketSize> bytes;
+	};
+
+	etl::array<Transaction, Transactions> transactions;
+
+	Transaction* find(LargeMessageTransactionId identifier) {
+		for (auto& transaction: transactions) {
+			if (transaction.inUse and transaction.identifier == identifier) {
+				return &transaction;
+			}
+		}
+		return nullptr;
+	}
+
+	Transaction* start(LargeMessageTransactionId identifier) {
+		for (auto& transaction: transactions) {
+			if (not transaction.inUse) {
+				transaction.inUse = true;
+				transaction.identifier = identifier;
+				transaction.lastPart = UnknownLastPart;
+				transaction.highestPart = 0;
+				transaction.receivedParts = 0;
+				transaction.packetSize = 0;
+				transaction.received.reset();
+				return &transaction;
+			}
+		}
+		return nullptr;
+	}
+
+	/**
+	 * @return Whether a part is consistent with its own type, and with the parts of its transaction so far
+	 */
+	static bool isValidPart(const Transaction* transaction, PartSequenceNum sequenceNumber, PartType type, size_t size) {
+		if (sequenceNumber >= MaxParts or ((sequenceNumber == 0) != (type == PartType::First) and type != PartType::Last)) {
+			return false;
+		}
+
+		if (type != PartType::Last) {
+			if (size != PartSize) {
+				return false;
+			}
+			return transaction == nullptr or transaction->lastPart == UnknownLastPart or
+			       sequenceNumber < transaction->lastPart;
+		}
+
+		if (size == 0 or size > PartSize or sequenceNumber * PartSize + size > MaxPacketSize) {
+			return false;
+		}
+		return transaction == nullptr or
+		       (transaction->lastPart == UnknownLastPart and transaction->highestPart < sequenceNumber) or
+		       transaction->lastPart == sequenceNumber;
+	}
+
+public:
+	/**
+	 * Stores a part of a large packet. When the part completes its packet, the transaction is released, and then
+	 * \p completed is called with the whole packet, as `completed(LargeMessageTransactionId, etl::span<const uint8_t>)`.
+	 * The handler may therefore receive further parts, e.g. by executing the packet, but the packet is only valid until
+	 * the next call of receivePart.
+	 *
+	 * A single part with the sequence number 0 and the Last type is a complete packet by itself.
+	 *
+	 * @param now The current time, used to abandon stale transactions
+	 */
+	template <typename CompletionHandler>
+	PartResult receivePart(LargeMessageTransactionId identifier, PartSequenceNum sequenceNumber, PartType type,
+	                       etl::span<const uint8_t> data, const Time::DefaultCUC& now, CompletionHandler&& completed) {
+		Transaction* transaction = find(identifier);
+		if (not isValidPart(transaction, sequenceNumber, type, data.size())) {
+			return PartResult::InvalidPart;
+		}
+
+		if (transaction == nullptr) {
+			transaction = start(identifier);
+			if (transaction == nullptr) {
+				return PartResult::NoFreeTransaction;
+			}
+		} else if (transaction->received.test(sequenceNumber)) {
+			return PartResult::Duplicate;
+		}
+
+		std::copy(data.begin(), data.end(), transaction->bytes.begin() + sequenceNumber * PartSize);
+		transaction->received.set(sequenceNumber);
+		transaction->receivedParts++;
+		transaction->highestPart = std::max(transaction->highestPart, sequenceNumber);
+		transaction->lastActivity = now;
+		if (type == PartType::Last) {
+			transaction->lastPart = sequenceNumber;
+			transaction->packetSize = sequenceNumber * PartSize + data.size();
+		}
+
+		if (transaction->lastPart == UnknownLastPart or transaction->receivedParts != transaction->lastPart + 1U) {
+			return PartResult::Accepted;
+		}
+
+		transaction->inUse = false;
+		completed(identifier, etl::span<const uint8_t>(transaction->bytes.data(), transaction->packetSize));
+		return PartResult::Completed;
+	}
+
+	/**
+	 * Abandons the transactions that have received no part for longer than \p timeout
+	 * @return The number of abandoned transactions
+	 */
+	template <class Duration>
+	size_t expire(const Time::DefaultCUC& now, const Duration& timeout) {
+		size_t expired = 0;
+		for (auto& transaction: transactions) {
+			if (transaction.inUse and transaction.lastActivity + timeout < now) {
+				transaction.inUse = false;
+				expired++;
+			}
+		}
+		return expired;
+	}
+
+	/**
+	 * @return The number of large packets that are being reassembled
+	 */
+	size_t activeTransactions() const {
+		return std::count_if(transactions.begin(), transactions.end(),
+		                     [](const Transaction& transaction) { return transaction.inUse; });
+	}
+
+	/**
+	 * Abandons all the transactions
+	 */
+	void clear() {
+		for (auto& transaction: transactions) {
+			transaction.inUse = false;
+		}
+	}
+};
+
+#endif // ECSS_SERVICES_LARGEPACKETREASSEMBLER_HPP
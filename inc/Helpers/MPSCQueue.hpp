@@ -0,0 +1,116 @@
+#ifndef ECSS_SERVICES_MPSCQUEUE_HPP
+#define ECSS_SERVICES_MPSCQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "etl/array.h"
+
+/**
+ * A fixed-capacity, lock-free queue with multiple producers and a single consumer.
+ *
+ * Every cell of the ring carries a sequence number, which tells whether the cell is free for the producer that claimed
+ * its position, or holds a value for the consumer. Producers claim a position with a single compare-and-swap, so that
+ * they never wait for each other and can push from interrupt handlers, as long as the target supports lock-free
+ * atomics of size_t. The consumer does not need any atomic read-modify-write operations.
+ *
+ * @tparam T The type of the elements, which is copied in and out of the queue
+ * @tparam Capacity The maximum number of elements in the queue, which must be a power of two
+ */
+template <typename T, size_t Capacity>
+class MPSCQueue {
+	static_assert(Capacity >= 2 and (Capacity & (Capacity - 1)) == 0, "The capacity must be a power of two");
+
+	static constexpr size_t PositionMask = Capacity - 1;
+
+	struct Cell {
+		/**
+		 * Equal to the position of the cell when it is free for a producer, or to the position plus one when it
+		 * holds a value for the consumer
+		 */
+		std::atomic<size_t> sequence;
+		T value;
+	};
+
+	etl::array<Cell, Capacity> cells;
+
+	/**
+	 * The position that will be claimed by the next producer
+	 */
+	std::atomic<size_t> enqueuePosition{0};
+
+	/**
+	 * The position that will be read by the consumer. Only accessed by the consumer.
+	 */
+	size_t dequeuePosition = 0;
+
+public:
+	MPSCQueue() {
+		for (size_t position = 0; position < Capacity; position++) {
+			cells[position].sequence.store(position, std::memory_order_relaxed);
+		}
+	}
+
+	MPSCQueue(const MPSCQueue&) = delete;
+	MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+	/**
+	 * Adds an element to the queue. Can be called concurrently by any number of producers.
+	 *
+	 * @return False if the queue is full, in which case the element is not added
+	 */
+	bool push(const T& value) {
+		size_t position = enqueuePosition.load(std::memory_order_relaxed);
+		while (true) {
+			Cell& cell = cells[position & PositionMask];
+			const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+			if (difference == 0) {
+				if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					cell.value = value;
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			} else if (difference < 0) {
+				return false;
+			} else {
+				position = enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/**
+	 * Removes the oldest element from the queue. Must only be called by the single consumer.
+	 *
+	 * @return False if the queue is empty, or if the oldest element is still being written by its producer
+	 */
+	bool pop(T& value) {
+		Cell& cell = cells[dequeuePosition & PositionMask];
+		if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) {
+			return false;
+		}
+
+		value = cell.value;
+		cell.sequence.store(dequeuePosition + Capacity, std::memory_order_release);
+		dequeuePosition++;
+		return true;
+	}
+
+	/**
+	 * @return The number of elements in the queue. Only exact while no producer is pushing.
+	 */
+	size_t size() const {
+		return enqueuePosition.load(std::memory_order_acquire) - dequeuePosition;
+	}
+
+	bool empty() const {
+		return size() == 0;
+	}
+
+	static constexpr size_t capacity() {
+		return Capacity;
+	}
+};
+
+#endif // ECSS_SERVICES_MPSCQUEUE_HPP
@@ -8,6 +8,7 @@
 #include "etl/array.h"
 #include "etl/list.h"
 #include "etl/map.h"
+#include "etl/variant.h"
 
 /**
  * Base class for Parameter Monitoring definitions. Contains the common variables of all check types.
@@ -27,6 +28,16 @@ public:
 		AboveHighThreshold = 10
 	};
 
+	/**
+	 * The type of check performed by a Parameter Monitoring definition. It is used to dispatch the evaluation to the
+	 * relevant subclass, without the need for virtual functions.
+	 */
+	enum CheckType : uint8_t {
+		ExpectedValueCheck = 0,
+		LimitCheck = 1,
+		DeltaCheck = 2
+	};
+
 	PMONId monitoredParameterId;
 
 	std::reference_wrapper<ParameterBase> monitoredParameter;
@@ -41,12 +52,42 @@ public:
 	bool monitoringEnabled = false;
 	CheckingStatus checkingStatus = Unchecked;
 	etl::array<CheckingStatus, 2> checkTransitionList = {};
+	CheckType checkType;
+	/**
+	 * The time between two consecutive checks of this definition, in milliseconds. If zero, the definition is checked
+	 * on every monitoring cycle.
+	 */
+	uint32_t monitoringInterval = 0;
+	/**
+	 * The time when the next check of this definition is due, in milliseconds.
+	 */
+	TimeStamps nextCheckTime = 0;
+	/**
+	 * The check result that is waiting for confirmation by repetitionNumber consecutive checks.
+	 */
+	CheckingStatus pendingCheckingStatus = Unchecked;
+
+	/**
+	 * Applies the repetition counting logic to a new check result. A new checking status is only recorded after the
+	 * same result has been obtained repetitionNumber consecutive times.
+	 *
+	 * @param checkResult The result of the latest check. Unchecked means that no result is available yet, and is
+	 * ignored.
+	 * @return true if the checking status changed, in which case checkTransitionList holds the previous and the new
+	 * checking status.
+	 */
+	bool updateCheckingStatus(CheckingStatus checkResult);
+
+	/**
+	 * Resets the checking status and the repetition counter, so that the next checks start from an unchecked state.
+	 */
+	void resetCheckingStatus();
 
 protected:
 	/**
 	 * @param monitoredParameterId is assumed to be correct and not checked.
 	 */
-	PMONBase(PMONId monitoredParameterId, uint16_t repetitionNumber);
+	PMONBase(PMONId monitoredParameterId, uint16_t repetitionNumber, CheckType checkType);
 };
 
 /**
@@ -61,7 +102,12 @@ public:
 	explicit PMONExpectedValueCheck(PMONId monitoredParameterId, uint16_t repetitionNumber, double expectedValue,
 	                                uint64_t mask, uint16_t unexpectedValueEvent)
 	    : expectedValue(expectedValue), mask(mask), unexpectedValueEvent(unexpectedValueEvent),
-	      PMONBase(monitoredParameterId, repetitionNumber){};
+	      PMONBase(monitoredParameterId, repetitionNumber, ExpectedValueCheck){};
+
+	/**
+	 * Compares the masked value of the monitored parameter against the expected value.
+	 */
+	CheckingStatus checkValue(double value) const;
 };
 
 /**
@@ -77,7 +123,20 @@ public:
 	explicit PMONLimitCheck(PMONId monitoredParameterId, uint16_t repetitionNumber, double lowLimit,
 	                        uint16_t belowLowLimitEvent, double highLimit, uint16_t aboveHighLimitEvent)
 	    : lowLimit(lowLimit), belowLowLimitEvent(belowLowLimitEvent), highLimit(highLimit),
-	      aboveHighLimitEvent(aboveHighLimitEvent), PMONBase(monitoredParameterId, repetitionNumber){};
+	      aboveHighLimitEvent(aboveHighLimitEvent), PMONBase(monitoredParameterId, repetitionNumber, LimitCheck){};
+
+	/**
+	 * Compares the value of the monitored parameter against the low and high limits.
+	 */
+	CheckingStatus checkValue(double value) const {
+		if (value < lowLimit) {
+			return BelowLowLimit;
+		}
+		if (value > highLimit) {
+			return AboveHighLimit;
+		}
+		return WithinLimits;
+	}
 };
 
 /**
@@ -91,12 +150,61 @@ public:
 	double highDeltaThreshold;
 	uint16_t aboveHighThresholdEvent;
 
+	/**
+	 * The value of the monitored parameter at the previous check, used to compute the next delta.
+	 */
+	double previousValue = 0;
+	bool previousValueIsValid = false;
+	/**
+	 * The sum and number of the deltas accumulated since the last evaluation against the thresholds.
+	 */
+	double deltaSum = 0;
+	uint16_t deltaCount = 0;
+
 	explicit PMONDeltaCheck(PMONId monitoredParameterId, uint16_t repetitionNumber,
 	                        uint16_t numberOfConsecutiveDeltaChecks, double lowDeltaThreshold,
 	                        uint16_t belowLowThresholdEvent, double highDeltaThreshold,
 	                        uint16_t aboveHighThresholdEvent)
 	    : numberOfConsecutiveDeltaChecks(numberOfConsecutiveDeltaChecks), lowDeltaThreshold(lowDeltaThreshold),
 	      belowLowThresholdEvent(belowLowThresholdEvent), highDeltaThreshold(highDeltaThreshold),
-	      aboveHighThresholdEvent(aboveHighThresholdEvent), PMONBase(monitoredParameterId, repetitionNumber){};
+	      aboveHighThresholdEvent(aboveHighThresholdEvent), PMONBase(monitoredParameterId, repetitionNumber, DeltaCheck){};
+
+	/**
+	 * Computes the delta between the current and the previous value of the monitored parameter. Once
+	 * numberOfConsecutiveDeltaChecks deltas have been accumulated, their average is compared against the thresholds.
+	 *
+	 * @return The result of the threshold comparison, or Unchecked if not enough deltas have been accumulated yet.
+	 */
+	CheckingStatus checkValue(double value);
+
+	/**
+	 * Discards the stored value and deltas, so that the next check starts a new delta history.
+	 */
+	void resetDeltaHistory() {
+		previousValueIsValid = false;
+		deltaSum = 0;
+		deltaCount = 0;
+	}
 };
+
+/**
+ * Storage for a Parameter Monitoring definition of any check type, so that definitions can be owned by the
+ * \ref OnBoardMonitoringService without dynamic allocation.
+ */
+using PMONVariant = etl::variant<PMONExpectedValueCheck, PMONLimitCheck, PMONDeltaCheck>;
+
+/**
+ * @return The common part of a Parameter Monitoring definition stored in a PMONVariant
+ */
+inline PMONBase& getPMONBase(PMONVariant& definition) {
+	switch (definition.index()) {
+		case 0:
+			return etl::get<PMONExpectedValueCheck>(definition);
+		case 1:
+			return etl::get<PMONLimitCheck>(definition);
+		default:
+			return etl::get<PMONDeltaCheck>(definition);
+	}
+}
+
 #endif // ECSS_SERVICES_PMONBASE_HPP
@@ -0,0 +1,223 @@
+#ifndef ECSS_SERVICES_PMONLIMITCHECKBATCH_HPP
+#define ECSS_SERVICES_PMONLIMITCHECKBATCH_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include "Helpers/PMONBase.hpp"
+#include "Helpers/Parameter.hpp"
+#include "etl/array.h"
+#include "etl/binary.h"
+
+/**
+ * A batch of limit checks, stored as a structure of arrays, so that all of them can be evaluated in a single pass
+ * without going through the individual Parameter Monitoring definitions.
+ *
+ * The slots are kept between evaluations, and only have to be rebuilt when the limit checks change. Each slot knows
+ * where the value of its parameter is stored, so the values are read without a virtual call per parameter. Only the
+ * parameters of a plain arithmetic type that are not stored in memory fall back to ParameterBase::getValueAsDouble().
+ *
+ * Every evaluation first reads the values of the slots that have been marked as due, and compares every value against
+ * its limits with branch-free arithmetic over contiguous arrays, so that the compiler can vectorize it on any target
+ * that supports it. It then packs the due slots whose result differs from their recorded status into a bitmask, which
+ * is walked sparsely. Since most checks are within limits most of the time, only a few slots have to be processed per
+ * cycle.
+ *
+ * @tparam Capacity The maximum number of limit checks in the batch
+ */
+template <size_t Capacity>
+class PMONLimitCheckBatch {
+public:
+	/**
+	 * The number of slots that are covered by each word of the transition bitmask
+	 */
+	static constexpr size_t SlotsPerMaskWord = 32;
+
+private:
+	static constexpr size_t MaskWords = (Capacity + SlotsPerMaskWord - 1) / SlotsPerMaskWord;
+
+	etl::array<double, Capacity> values{};
+	etl::array<ParameterBase::ValueType, Capacity> valueTypes{};
+	etl::array<const void*, Capacity> valueAddresses{};
+	/**
+	 * The parameters of the slots, only used for the values that cannot be read straight from memory
+	 */
+	etl::array<ParameterBase*, Capacity> parameters{};
+	etl::array<double, Capacity> lowLimits{};
+	etl::array<double, Capacity> highLimits{};
+	/**
+	 * The checking status that is currently recorded for each slot
+	 */
+	etl::array<uint8_t, Capacity> statuses{};
+	/**
+	 * Non-zero for the slots which have a check result waiting for confirmation, so that they are processed even if
+	 * their latest result is equal to their recorded status.
+	 */
+	etl::array<uint8_t, Capacity> pending{};
+	/**
+	 * Non-zero for the slots which are checked by the next evaluation
+	 */
+	etl::array<uint8_t, Capacity> due{};
+	/**
+	 * The result of the latest evaluation for each slot
+	 */
+	etl::array<uint8_t, Capacity> results{};
+	/**
+	 * The slots that need to be processed after the latest evaluation
+	 */
+	etl::array<uint32_t, MaskWords> transitionMask{};
+
+	size_t slotCount = 0;
+
+	size_t usedMaskWords() const {
+		return (slotCount + SlotsPerMaskWord - 1) / SlotsPerMaskWord;
+	}
+
+	double readValue(size_t slot) const {
+		using ValueType = ParameterBase::ValueType;
+		const void* address = valueAddresses[slot];
+		switch (valueTypes[slot]) {
+			case ValueType::Bool:
+				return *static_cast<const bool*>(address);
+			case ValueType::Uint8:
+				return *static_cast<const uint8_t*>(address);
+			case ValueType::Int8:
+				return *static_cast<const int8_t*>(address);
+			case ValueType::Uint16:
+				return *static_cast<const uint16_t*>(address);
+			case ValueType::Int16:
+				return *static_cast<const int16_t*>(address);
+			case ValueType::Uint32:
+				return *static_cast<const uint32_t*>(address);
+			case ValueType::Int32:
+				return *static_cast<const int32_t*>(address);
+			case ValueType::Uint64:
+				return static_cast<double>(*static_cast<const uint64_t*>(address));
+			case ValueType::Int64:
+				return static_cast<double>(*static_cast<const int64_t*>(address));
+			case ValueType::Float:
+				return *static_cast<const float*>(address);
+			case ValueType::Double:
+				return *static_cast<const double*>(address);
+			default:
+				return parameters[slot]->getValueAsDouble();
+		}
+	}
+
+public:
+	/**
+	 * Adds a limit check to the batch. The slot is not checked until it is marked as due.
+	 *
+	 * @param parameter The monitored parameter, which must outlive the slot
+	 * @return The slot of the new limit check, or Capacity if the batch is full.
+	 */
+	size_t add(double lowLimit, double highLimit, ParameterBase& parameter) {
+		if (slotCount == Capacity) {
+			return Capacity;
+		}
+		const ParameterBase::ValueSource source = parameter.getValueSource();
+		valueTypes[slotCount] = source.type;
+		valueAddresses[slotCount] = source.address;
+		parameters[slotCount] = &parameter;
+		lowLimits[slotCount] = lowLimit;
+		highLimits[slotCount] = highLimit;
+		statuses[slotCount] = PMONBase::Unchecked;
+		pending[slotCount] = 0;
+		due[slotCount] = 0;
+		values[slotCount] = 0;
+		return slotCount++;
+	}
+
+	/**
+	 * Removes all the limit checks from the batch.
+	 */
+	void clear() {
+		slotCount = 0;
+		transitionMask.fill(0);
+	}
+
+	size_t size() const {
+		return slotCount;
+	}
+
+	bool full() const {
+		return slotCount == Capacity;
+	}
+
+	/**
+	 * Marks a slot to be checked by the next evaluation, and records its current checking status.
+	 *
+	 * @param isPending true if the slot has a check result waiting for confirmation
+	 */
+	void setDue(size_t slot, PMONBase::CheckingStatus status, bool isPending) {
+		statuses[slot] = status;
+		pending[slot] = isPending;
+		due[slot] = 1;
+	}
+
+	/**
+	 * @return The value that was checked for a slot by the latest evaluation
+	 */
+	double getValue(size_t slot) const {
+		return values[slot];
+	}
+
+	PMONBase::CheckingStatus getStatus(size_t slot) const {
+		return static_cast<PMONBase::CheckingStatus>(statuses[slot]);
+	}
+
+	PMONBase::CheckingStatus getResult(size_t slot) const {
+		return static_cast<PMONBase::CheckingStatus>(results[slot]);
+	}
+
+	/**
+	 * Checks the current value of every due slot against its limits, and clears the due marks.
+	 *
+	 * @return The number of due slots whose result differs from their recorded status, or that have a pending result.
+	 */
+	size_t evaluate() {
+		for (size_t slot = 0; slot < slotCount; slot++) {
+			if (due[slot] != 0) {
+				values[slot] = readValue(slot);
+			}
+		}
+
+		for (size_t slot = 0; slot < slotCount; slot++) {
+			const uint8_t belowLowLimit = values[slot] < lowLimits[slot];
+			const uint8_t aboveHighLimit = values[slot] > highLimits[slot];
+			results[slot] = PMONBase::WithinLimits + belowLowLimit + 2 * aboveHighLimit;
+		}
+
+		size_t marked = 0;
+		for (size_t word = 0; word < usedMaskWords(); word++) {
+			const size_t firstSlot = word * SlotsPerMaskWord;
+			const size_t lastSlot = std::min(firstSlot + SlotsPerMaskWord, slotCount);
+			uint32_t mask = 0;
+			for (size_t slot = firstSlot; slot < lastSlot; slot++) {
+				const uint32_t marks = due[slot] & ((results[slot] != statuses[slot]) | (pending[slot] != 0));
+				mask |= marks << (slot - firstSlot);
+			}
+			transitionMask[word] = mask;
+			marked += etl::count_bits(mask);
+		}
+
+		std::fill_n(due.begin(), slotCount, 0);
+		return marked;
+	}
+
+	/**
+	 * Calls a function for every slot that was marked by the latest evaluation.
+	 *
+	 * @param function Called with the slot and its latest check result
+	 */
+	template <typename Function>
+	void forEachMarkedSlot(Function&& function) const {
+		for (size_t word = 0; word < usedMaskWords(); word++) {
+			for (uint32_t mask = transitionMask[word]; mask != 0; mask &= mask - 1) {
+				const size_t slot = word * SlotsPerMaskWord + etl::count_trailing_zeros(mask);
+				function(slot, static_cast<PMONBase::CheckingStatus>(results[slot]));
+			}
+		}
+	}
+};
+
+#endif // ECSS_SERVICES_PMONLIMITCHECKBATCH_HPP
@@ -1,6 +1,7 @@
 #ifndef ECSS_SERVICES_PARAMETER_HPP
 #define ECSS_SERVICES_PARAMETER_HPP
 
+#include <type_traits>
 #include "etl/String.hpp"
 #include "Message.hpp"
 #include "ECSS_Definitions.hpp"
@@ -49,6 +50,73 @@ public:
 	 * then usually 0 is returned.
 	 */
 	virtual double getValueAsDouble() = 0;
+
+	/**
+	 * The arithmetic types of parameter values that can be read straight from memory
+	 */
+	enum class ValueType : uint8_t {
+		Unknown = 0,
+		Bool,
+		Uint8,
+		Int8,
+		Uint16,
+		Int16,
+		Uint32,
+		Int32,
+		Uint64,
+		Int64,
+		Float,
+		Double
+	};
+
+	/**
+	 * The location and type of the value of a parameter
+	 */
+	struct ValueSource {
+		ValueType type = ValueType::Unknown;
+		const void* address = nullptr;
+	};
+
+	/**
+	 * Gets where the value of the parameter is stored, so that loops over many parameters can read their values
+	 * without a virtual call for each one. The address stays valid for the lifetime of the parameter.
+	 *
+	 * @return The value source, or an Unknown one if the value is not stored as a plain arithmetic type, in which
+	 * case getValueAsDouble() has to be used
+	 */
+	virtual ValueSource getValueSource() {
+		return {};
+	}
+
+protected:
+	template <typename DataType>
+	static constexpr ValueType valueTypeOf() {
+		if constexpr (std::is_same_v<DataType, bool>) {
+			return ValueType::Bool;
+		} else if constexpr (std::is_same_v<DataType, uint8_t>) {
+			return ValueType::Uint8;
+		} else if constexpr (std::is_same_v<DataType, int8_t>) {
+			return ValueType::Int8;
+		} else if constexpr (std::is_same_v<DataType, uint16_t>) {
+			return ValueType::Uint16;
+		} else if constexpr (std::is_same_v<DataType, int16_t>) {
+			return ValueType::Int16;
+		} else if constexpr (std::is_same_v<DataType, uint32_t>) {
+			return ValueType::Uint32;
+		} else if constexpr (std::is_same_v<DataType, int32_t>) {
+			return ValueType::Int32;
+		} else if constexpr (std::is_same_v<DataType, uint64_t>) {
+			return ValueType::Uint64;
+		} else if constexpr (std::is_same_v<DataType, int64_t>) {
+			return ValueType::Int64;
+		} else if constexpr (std::is_same_v<DataType, float>) {
+			return ValueType::Float;
+		} else if constexpr (std::is_same_v<DataType, double>) {
+			return ValueType::Double;
+		} else {
+			return ValueType::Unknown;
+		}
+	}
 };
 
 /**
@@ -80,6 +148,10 @@ public:
 		}
 	}
 
+	inline ValueSource getValueSource() override {
+		return {valueTypeOf<DataType>(), &currentValue};
+	}
+
 	inline void setValueFromMessage(Message& message) override {
 		currentValue = message.read<DataType>();
 	};
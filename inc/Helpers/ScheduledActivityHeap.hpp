@@ -0,0 +1,433 @@
+#ifndef ECSS_SERVICES_SCHEDULEDACTIVITYHEAP_HPP
+#define ECSS_SERVICES_SCHEDULEDACTIVITYHEAP_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include "etl/array.h"
+#include "etl/multimap.h"
+#include "etl/vector.h"
+
+/**
+ * A fixed-capacity container of scheduled activities, ordered by their release time.
+ *
+ * The activities are stored in a pool of slots, which never move once an activity is inserted. A binary min-heap of
+ * slots keeps the activity with the earliest release time at the top, and an index maps each request identifier to the
+ * slots of its activities. Inserting an activity, removing it, finding it by its request identifier or changing its
+ * release time only costs O(log n), instead of sorting the whole schedule.
+ *
+ * Activities with the same release time are ordered by the order in which they were inserted.
+ *
+ * An activity can be parked, which takes it out of the heap while it keeps its slot and stays in the index. Parked
+ * activities are never at the front and are not released, but they are still found, shifted, erased and reported.
+ *
+ * @tparam T The type of the activities, which must have a `requestReleaseTime` member, and a `requestID` member with a
+ * strict weak ordering
+ * @tparam Capacity The maximum number of activities
+ */
+template <typename T, size_t Capacity>
+class ScheduledActivityHeap {
+	static_assert(Capacity < UINT16_MAX - 1, "The slots of the activities must fit in 16 bits");
+
+public:
+	using Slot = uint16_t;
+	using RequestID = decltype(T::requestID);
+
+	/**
+	 * Returned instead of a slot when no activity matches
+	 */
+	static constexpr Slot NoSlot = Capacity;
+
+	/**
+	 * The slots of a set of activities
+	 */
+	using SlotList = etl::vector<Slot, Capacity>;
+
+private:
+	etl::array<T, Capacity> activities;
+
+	/**
+	 * Used instead of a heap position for the slots of parked activities
+	 */
+	static constexpr Slot Parked = Capacity;
+
+	/**
+	 * Used instead of a heap position for the slots that do not hold an activity
+	 */
+	static constexpr Slot Free = Capacity + 1;
+
+	/**
+	 * The position of each occupied slot in the heap, or Parked or Free
+	 */
+	etl::array<Slot, Capacity> heapPositions{};
+
+	/**
+	 * A counter value for each occupied slot, which orders activities with equal release times
+	 */
+	etl::array<uint32_t, Capacity> insertionOrders{};
+	uint32_t nextInsertionOrder = 0;
+
+	/**
+	 * The occupied slots that are not parked, arranged as a binary min-heap on the release time
+	 */
+	etl::vector<Slot, Capacity> heap;
+
+	/**
+	 * The number of parked activities
+	 */
+	size_t parkedCount = 0;
+
+	/**
+	 * The slots that do not hold an activity
+	 */
+	etl::vector<Slot, Capacity> freeSlots;
+
+	etl::multimap<RequestID, Slot, Capacity> requestIDIndex;
+
+	bool isEarlier(Slot leftSide, Slot rightSide) const {
+		if (activities[leftSide].requestReleaseTime < activities[rightSide].requestReleaseTime) {
+			return true;
+		}
+		if (activities[rightSide].requestReleaseTime < activities[leftSide].requestReleaseTime) {
+			return false;
+		}
+		return insertionOrders[leftSide] < insertionOrders[rightSide];
+	}
+
+	void placeInHeap(size_t position, Slot slot) {
+		heap[position] = slot;
+		heapPositions[slot] = position;
+	}
+
+	void siftUp(size_t position) {
+		const Slot slot = heap[position];
+		while (position > 0) {
+			const size_t parent = (position - 1) / 2;
+			if (not isEarlier(slot, heap[parent])) {
+				break;
+			}
+			placeInHeap(position, heap[parent]);
+			position = parent;
+		}
+		placeInHeap(position, slot);
+	}
+
+	void siftDown(size_t position) {
+		const Slot slot = heap[position];
+		while (true) {
+			size_t child = 2 * position + 1;
+			if (child >= heap.size()) {
+				break;
+			}
+			if (child + 1 < heap.size() and isEarlier(heap[child + 1], heap[child])) {
+				child++;
+			}
+			if (not isEarlier(heap[child], slot)) {
+				break;
+			}
+			placeInHeap(position, heap[child]);
+			position = child;
+		}
+		placeInHeap(position, slot);
+	}
+
+	/**
+	 * Restores the heap order after the release time of an activity has changed
+	 */
+	void reposition(Slot slot) {
+		const size_t position = heapPositions[slot];
+		if (position > 0 and isEarlier(slot, heap[(position - 1) / 2])) {
+			siftUp(position);
+		} else {
+			siftDown(position);
+		}
+	}
+
+	void removeFromHeap(Slot slot) {
+		const size_t position = heapPositions[slot];
+		const Slot lastSlot = heap.back();
+		heap.pop_back();
+		if (lastSlot != slot) {
+			placeInHeap(position, lastSlot);
+			reposition(lastSlot);
+		}
+	}
+
+	void removeFromIndex(Slot slot) {
+		auto range = requestIDIndex.equal_range(activities[slot].requestID);
+		for (auto entry = range.first; entry != range.second; ++entry) {
+			if (entry->second == slot) {
+				requestIDIndex.erase(entry);
+				return;
+			}
+		}
+	}
+
+public:
+	ScheduledActivityHeap() {
+		clear();
+	}
+
+	size_t size() const {
+		return Capacity - freeSlots.size();
+	}
+
+	bool empty() const {
+		return freeSlots.full();
+	}
+
+	bool full() const {
+		return freeSlots.empty();
+	}
+
+	size_t available() const {
+		return freeSlots.size();
+	}
+
+	T& operator[](Slot slot) {
+		return activities[slot];
+	}
+
+	const T& operator[](Slot slot) const {
+		return activities[slot];
+	}
+
+	/**
+	 * @return The slot of the activity with the earliest release time that is not parked, or NoSlot if there is none
+	 */
+	Slot front() const {
+		return heap.empty() ? NoSlot : heap.front();
+	}
+
+	/**
+	 * @return The slot of the activity with the earliest release time, including the parked ones, or NoSlot if there
+	 * is none. This scans all the slots when some activities are parked.
+	 */
+	Slot earliest() const {
+		Slot match = front();
+		if (parkedCount == 0) {
+			return match;
+		}
+		for (Slot slot = 0; slot < Capacity; slot++) {
+			if (heapPositions[slot] == Parked and (match == NoSlot or isEarlier(slot, match))) {
+				match = slot;
+			}
+		}
+		return match;
+	}
+
+	/**
+	 * Adds an activity.
+	 *
+	 * @param parked Whether the activity is added as parked
+	 * @return The slot of the new activity, or NoSlot if the container is full
+	 */
+	Slot insert(const T& activity, bool parked = false) {
+		if (freeSlots.empty()) {
+			return NoSlot;
+		}
+		const Slot slot = freeSlots.back();
+		freeSlots.pop_back();
+
+		activities[slot] = activity;
+		insertionOrders[slot] = nextInsertionOrder++;
+		heapPositions[slot] = Parked;
+		parkedCount++;
+		if (not parked) {
+			unpark(slot);
+		}
+		requestIDIndex.insert(std::make_pair(activity.requestID, slot));
+		return slot;
+	}
+
+	/**
+	 * Removes an activity. Its slot can be reused by the next insertion.
+	 */
+	void erase(Slot slot) {
+		removeFromIndex(slot);
+		if (heapPositions[slot] != Parked) {
+			removeFromHeap(slot);
+		} else {
+			parkedCount--;
+		}
+		heapPositions[slot] = Free;
+		freeSlots.push_back(slot);
+	}
+
+	/**
+	 * Takes an activity out of the release order, without removing it.
+	 */
+	void park(Slot slot) {
+		if (heapPositions[slot] != Parked) {
+			removeFromHeap(slot);
+			heapPositions[slot] = Parked;
+			parkedCount++;
+		}
+	}
+
+	/**
+	 * Puts a parked activity back in the release order.
+	 */
+	void unpark(Slot slot) {
+		if (heapPositions[slot] == Parked) {
+			parkedCount--;
+			heap.push_back(slot);
+			siftUp(heap.size() - 1);
+		}
+	}
+
+	bool isParked(Slot slot) const {
+		return heapPositions[slot] == Parked;
+	}
+
+	/**
+	 * Removes every activity.
+	 */
+	void clear() {
+		heap.clear();
+		requestIDIndex.clear();
+		freeSlots.clear();
+		for (size_t slot = Capacity; slot > 0; slot--) {
+			freeSlots.push_back(slot - 1);
+		}
+		heapPositions.fill(Free);
+		parkedCount = 0;
+		nextInsertionOrder = 0;
+	}
+
+	/**
+	 * @return The slot of the activity with the earliest release time among the ones with the given request
+	 * identifier, or NoSlot if there is none
+	 */
+	Slot find(const RequestID& requestID) const {
+		Slot match = NoSlot;
+		auto range = requestIDIndex.equal_range(requestID);
+		for (auto entry = range.first; entry != range.second; ++entry) {
+			if (match == NoSlot or isEarlier(entry->second, match)) {
+				match = entry->second;
+			}
+		}
+		return match;
+	}
+
+	/**
+	 * Removes the activities that are due, in the order of their release time, and passes each of them to a function.
+	 *
+	 * The function is called after the activity has been removed, with its former slot and a copy of the activity, so
+	 * it may insert or remove other activities. The front of the heap is checked again after every call.
+	 *
+	 * @param currentTime Activities with a release time up to this time are due
+	 * @param maximumActivities The maximum number of activities to remove
+	 * @param release The function that is called for each removed activity, as `release(Slot, const T&)`
+	 * @return The number of removed activities
+	 */
+	template <class Time, class Function>
+	size_t releaseDue(const Time& currentTime, size_t maximumActivities, Function&& release) {
+		size_t released = 0;
+		while (released < maximumActivities and not heap.empty()) {
+			const Slot slot = heap.front();
+			if (currentTime < activities[slot].requestReleaseTime) {
+				break;
+			}
+			const T activity = activities[slot];
+			erase(slot);
+			release(slot, activity);
+			released++;
+		}
+		return released;
+	}
+
+	/**
+	 * Changes the release time of an activity.
+	 */
+	template <class Duration>
+	void shift(Slot slot, const Duration& offset) {
+		activities[slot].requestReleaseTime += offset;
+		if (heapPositions[slot] != Parked) {
+			reposition(slot);
+		}
+	}
+
+	/**
+	 * Changes the release time of every activity by the same offset. Since the order of the activities does not
+	 * change, this does not need to touch the heap.
+	 */
+	template <class Duration>
+	void shiftAll(const Duration& offset) {
+		for (Slot slot = 0; slot < Capacity; slot++) {
+			if (heapPositions[slot] != Free) {
+				activities[slot].requestReleaseTime += offset;
+			}
+		}
+	}
+
+	/**
+	 * Sorts a list of slots by the release time of their activities.
+	 */
+	void sortByReleaseTime(SlotList& slots) const {
+		std::sort(slots.begin(), slots.end(), [this](Slot leftSide, Slot rightSide) {
+			return isEarlier(leftSide, rightSide);
+		});
+	}
+
+	/**
+	 * @return The slots of all the activities, including the parked ones, ordered by their release time
+	 */
+	SlotList slotsInReleaseOrder() const {
+		SlotList slots;
+		for (Slot slot = 0; slot < Capacity; slot++) {
+			if (heapPositions[slot] != Free) {
+				slots.push_back(slot);
+			}
+		}
+		sortByReleaseTime(slots);
+		return slots;
+	}
+
+	/**
+	 * Finds the activities released in a time window by scanning the heap up to the end of the window.
+	 *
+	 * This is not an indexed range query. Since no activity of the heap is released earlier than its parent, the scan
+	 * stops at the activities released after endTime, but it visits every activity released up to endTime, including
+	 * the ones released before startTime. Its cost grows with the number of activities released up to endTime, not
+	 * with the number of activities in the window. Parked activities are not in the heap, so they are checked one by
+	 * one, but only when there are any. Only the matching slots are sorted.
+	 *
+	 * @return The slots of the activities, including the parked ones, released from startTime to endTime, both
+	 * included, ordered by their release time
+	 */
+	template <class Time>
+	SlotList scanReleasedUntil(const Time& startTime, const Time& endTime) const {
+		SlotList slots;
+		etl::vector<Slot, Capacity> pendingPositions;
+		if (not heap.empty()) {
+			pendingPositions.push_back(0);
+		}
+		while (not pendingPositions.empty()) {
+			const size_t position = pendingPositions.back();
+			pendingPositions.pop_back();
+
+			const Slot slot = heap[position];
+			if (endTime < activities[slot].requestReleaseTime) {
+				continue;
+			}
+			if (not(activities[slot].requestReleaseTime < startTime)) {
+				slots.push_back(slot);
+			}
+			for (size_t child = 2 * position + 1; child <= 2 * position + 2 and child < heap.size(); child++) {
+				pendingPositions.push_back(child);
+			}
+		}
+
+		for (Slot slot = 0; parkedCount > 0 and slot < Capacity; slot++) {
+			if (heapPositions[slot] == Parked and not(activities[slot].requestReleaseTime < startTime) and
+			    not(endTime < activities[slot].requestReleaseTime)) {
+				slots.push_back(slot);
+			}
+		}
+
+		sortByReleaseTime(slots);
+		return slots;
+	}
+};
+
+#endif // ECSS_SERVICES_SCHEDULEDACTIVITYHEAP_HPP
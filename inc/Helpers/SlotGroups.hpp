@@ -0,0 +1,108 @@
+#ifndef ECSS_SERVICES_SLOTGROUPS_HPP
+#define ECSS_SERVICES_SLOTGROUPS_HPP
+
+#include <cstdint>
+#include "etl/array.h"
+
+/**
+ * Splits a set of slots, such as the slots of a ScheduledActivityHeap, into a fixed number of groups.
+ *
+ * Each group is an intrusive doubly linked list through the slots, so that the slots of a group can be visited without
+ * looking at the slots of any other group, and a slot can be added or removed in O(1). The memory used is fixed, and
+ * does not depend on how the slots are distributed among the groups.
+ *
+ * @tparam Capacity The number of slots, from 0 to Capacity - 1
+ * @tparam Groups The number of groups, from 0 to Groups - 1
+ */
+template <size_t Capacity, size_t Groups>
+class SlotGroups {
+	static_assert(Capacity < UINT16_MAX, "The slots must fit in 16 bits");
+	static_assert(Groups < UINT16_MAX, "The groups must fit in 16 bits");
+
+public:
+	using Slot = uint16_t;
+	using Group = uint16_t;
+
+private:
+	static constexpr Slot NoSlot = Capacity;
+
+	etl::array<Slot, Capacity> nextSlots{};
+	etl::array<Slot, Capacity> previousSlots{};
+
+	/**
+	 * The group of each slot that belongs to a group
+	 */
+	etl::array<Group, Capacity> slotGroups{};
+
+	etl::array<Slot, Groups> firstSlots{};
+	etl::array<uint16_t, Groups> groupSizes{};
+
+public:
+	SlotGroups() {
+		clear();
+	}
+
+	/**
+	 * Removes all the slots from all the groups.
+	 */
+	void clear() {
+		firstSlots.fill(NoSlot);
+		groupSizes.fill(0);
+	}
+
+	/**
+	 * Adds a slot, which must not be in any group, to a group.
+	 */
+	void add(Slot slot, Group group) {
+		const Slot first = firstSlots[group];
+		nextSlots[slot] = first;
+		previousSlots[slot] = NoSlot;
+		if (first != NoSlot) {
+			previousSlots[first] = slot;
+		}
+		firstSlots[group] = slot;
+		slotGroups[slot] = group;
+		groupSizes[group]++;
+	}
+
+	/**
+	 * Removes a slot from its group.
+	 */
+	void remove(Slot slot) {
+		const Group group = slotGroups[slot];
+		const Slot next = nextSlots[slot];
+		const Slot previous = previousSlots[slot];
+
+		if (previous == NoSlot) {
+			firstSlots[group] = next;
+		} else {
+			nextSlots[previous] = next;
+		}
+		if (next != NoSlot) {
+			previousSlots[next] = previous;
+		}
+		groupSizes[group]--;
+	}
+
+	/**
+	 * @return The number of slots in a group
+	 */
+	size_t size(Group group) const {
+		return groupSizes[group];
+	}
+
+	/**
+	 * Calls a function for every slot of a group, as `function(Slot)`. The function may remove the slot it is called
+	 * for, but no other slot of the group.
+	 */
+	template <class Function>
+	void forEach(Group group, Function&& function) const {
+		for (Slot slot = firstSlots[group]; slot != NoSlot;) {
+			const Slot next = nextSlots[slot];
+			function(slot);
+			slot = next;
+		}
+	}
+};
+
+#endif // ECSS_SERVICES_SLOTGROUPS_HPP
@@ -1,10 +1,13 @@
 #ifndef ECSS_SERVICES_STATISTIC_HPP
 #define ECSS_SERVICES_STATISTIC_HPP
 
+#include <limits>
 #include "ECSS_Definitions.hpp"
 #include "ErrorHandler.hpp"
+#include "Helpers/StatisticAccumulators.hpp"
 #include "Service.hpp"
 #include "TimeGetter.hpp"
+#include "etl/span.h"
 #include "etl/vector.h"
 
 /**
@@ -22,16 +25,52 @@ public:
 	double sumOfSquares = 0;
 	double mean = 0;
 
+	/**
+	 * Optional rolling window of the last samples. Disabled by default.
+	 */
+	StatisticWindow window;
+
+	/**
+	 * Optional histogram used to approximate the percentiles of the samples. Disabled by default.
+	 */
+	StatisticHistogram histogram;
+
+	/**
+	 * Flags appended before the optional statistics, indicating which of them follow
+	 */
+	enum AccumulatorFlags : uint8_t {
+		WindowEnabled = 1,
+		HistogramEnabled = 2,
+	};
+
 	Statistic() = default;
 
 	/**
-	 * Gets the value from the sensor as argument and updates the statistics without storing it
+	 * Gets the value from the sensor as argument and updates the statistics without storing it. The current time is
+	 * only fetched when the value is a new max or min.
 	 * @param value returned value from "getValue()" of Parameter.hpp, i.e. the last sampled value from a parameter
 	 */
 	void updateStatistics(double value);
 
 	/**
-	 * Resets all statistics calculated to default values
+	 * Updates the statistics with a value sampled at a known time. This avoids fetching the current time whenever a
+	 * new max or min value is found, so that a sampling pass only needs to get the time once.
+	 * @param value the last sampled value from a parameter
+	 * @param sampleTime the time at which \p value was sampled
+	 */
+	void updateStatistics(double value, const Time::DefaultCUC& sampleTime);
+
+	/**
+	 * Updates the statistics with a block of values that were all sampled at the same time. The max, min, sum and
+	 * sum of squares of the block are calculated in a single pass with independent accumulators, so that the loop
+	 * can be vectorized by the compiler, and then merged into the statistics.
+	 * @param values the sampled values of a parameter
+	 * @param sampleTime the time at which \p values were sampled
+	 */
+	void updateStatistics(etl::span<const double> values, const Time::DefaultCUC& sampleTime);
+
+	/**
+	 * Resets all statistics calculated to default values. The configuration of the window and histogram is kept.
 	 */
 	void resetStatistics();
 
@@ -41,6 +80,13 @@ public:
 	 */
 	void appendStatisticsToMessage(Message& report) const;
 
+	/**
+	 * Appends the optional window and percentile statistics to the received Message. A byte with the
+	 * AccumulatorFlags is appended first, followed by the number of samples, max, min and mean of the window if it is
+	 * enabled, and the 50th, 95th and 99th percentiles if the histogram is enabled.
+	 */
+	void appendAccumulatorsToMessage(Message& report) const;
+
 	/**
 	 * Setter function
 	 */
@@ -50,6 +96,13 @@ public:
 	 * Check if all the statistics are initialized
 	 */
 	bool statisticsAreInitialized() const;
+
+private:
+	/**
+	 * Adds a value to the mean, the sum of squares, the sample count, the window and the histogram, i.e. to every
+	 * statistic except the max and min
+	 */
+	void updateAccumulators(double value);
 };
 
 #endif
@@ -0,0 +1,151 @@
+#ifndef ECSS_SERVICES_STATISTICACCUMULATORS_HPP
+#define ECSS_SERVICES_STATISTICACCUMULATORS_HPP
+
+#include <cstdint>
+#include "ECSS_Definitions.hpp"
+#include "etl/array.h"
+
+/**
+ * A rolling window holding the last samples of a parameter, so that the statistics of the most recent samples can be
+ * reported, in addition to the statistics since the last reset.
+ *
+ * The window has a fixed memory footprint of ECSSMaxStatisticWindowSize samples, and the number of samples that it
+ * holds is configurable up to that limit. Adding a sample costs O(1), while the max, min and mean are calculated only
+ * when requested. Since statistics are sampled periodically, a window of the last T seconds is expressed as a window
+ * of T / samplingInterval samples.
+ */
+class StatisticWindow {
+private:
+	/**
+	 * Circular buffer with the samples of the window
+	 */
+	etl::array<double, ECSSMaxStatisticWindowSize> samples{};
+
+	/**
+	 * The configured number of samples of the window. Zero means that the window is disabled.
+	 */
+	uint8_t windowSize = 0;
+
+	/**
+	 * The number of samples currently in the window, up to windowSize
+	 */
+	uint8_t sampleCount = 0;
+
+	/**
+	 * The position in the circular buffer where the next sample will be stored
+	 */
+	uint8_t nextIndex = 0;
+
+public:
+	/**
+	 * Sets the number of samples of the window, and clears the stored samples.
+	 * @param size The number of samples. Values larger than ECSSMaxStatisticWindowSize are clamped to it.
+	 */
+	void setSize(uint8_t size);
+
+	inline uint8_t getSize() const {
+		return windowSize;
+	}
+
+	inline uint8_t getSampleCount() const {
+		return sampleCount;
+	}
+
+	inline bool isEnabled() const {
+		return windowSize != 0;
+	}
+
+	/**
+	 * Adds a sample to the window, replacing the oldest one if the window is full
+	 */
+	void update(double value);
+
+	/**
+	 * Clears the stored samples, keeping the configured size
+	 */
+	void reset();
+
+	/**
+	 * Returns the max value of the samples in the window, or 0 if the window is empty
+	 */
+	double getMax() const;
+
+	/**
+	 * Returns the min value of the samples in the window, or 0 if the window is empty
+	 */
+	double getMin() const;
+
+	/**
+	 * Returns the mean value of the samples in the window, or 0 if the window is empty
+	 */
+	double getMean() const;
+};
+
+/**
+ * A fixed-bin histogram of the samples of a parameter, used to approximate its percentiles.
+ *
+ * The range [lowLimit, highLimit) is divided into ECSSStatisticHistogramBins equal bins. Samples outside of the range
+ * are counted in the first or the last bin. Adding a sample costs O(1) and calculating a percentile costs
+ * O(ECSSStatisticHistogramBins), while the memory footprint is fixed. The error of a percentile is at most the width
+ * of one bin.
+ *
+ * When a bin is full, every bin is halved, so that the histogram keeps the shape of the distribution instead of
+ * dropping the samples of its fullest bin. The older samples then weigh less than the newer ones.
+ */
+class StatisticHistogram {
+private:
+	/**
+	 * The number of samples in each bin. All the bins are halved instead of overflowing.
+	 */
+	etl::array<uint16_t, ECSSStatisticHistogramBins> bins{};
+
+	double lowLimit = 0;
+	double highLimit = 0;
+
+	/**
+	 * The total number of samples in the bins, which is reduced whenever the bins are halved
+	 */
+	uint32_t sampleCount = 0;
+
+public:
+	/**
+	 * Sets the range of the histogram, and clears the stored samples. A range where \p high is not larger than
+	 * \p low disables the histogram.
+	 */
+	void setRange(double low, double high);
+
+	inline double getLowLimit() const {
+		return lowLimit;
+	}
+
+	inline double getHighLimit() const {
+		return highLimit;
+	}
+
+	inline uint32_t getSampleCount() const {
+		return sampleCount;
+	}
+
+	inline bool isEnabled() const {
+		return highLimit > lowLimit;
+	}
+
+	/**
+	 * Adds a sample to the bin that contains it
+	 */
+	void update(double value);
+
+	/**
+	 * Clears the stored samples, keeping the configured range
+	 */
+	void reset();
+
+	/**
+	 * Approximates a percentile of the samples, by interpolating linearly inside the bin that contains it.
+	 * @param percentile The requested percentile, from 0 to 100
+	 * @return The approximated value, or 0 if the histogram is empty
+	 */
+	double getPercentile(double percentile) const;
+};
+
+#endif
@@ -42,6 +42,11 @@ using MessageTypeNum = uint8_t;
 
 using SourceId = uint16_t;
 using SequenceCount = uint16_t;
+/**
+ * Identifiers of the sub-schedules and of the scheduling groups of the Time-based Scheduling Service.
+ */
+using SubScheduleId = uint8_t;
+using ScheduleGroupId = uint8_t;
 /**
  * Filling percentages of the packet stores, either total or from the open retrieval start time tag.
  */
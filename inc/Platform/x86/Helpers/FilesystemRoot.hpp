@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Helpers/Filesystem.hpp"
+
+/**
+ * Configuration of the POSIX filesystem backend of the x86 platform
+ *
+ * Every Filesystem::Path is resolved under a root directory on the host. Paths that contain a ".." component are
+ * rejected, so that no operation reaches outside the root directory.
+ */
+namespace Filesystem {
+	/**
+	 * The maximum size of the root directory on the host
+	 */
+	constexpr size_t RootDirectorySize = FullPathSize;
+	using RootDirectory = String<RootDirectorySize>;
+
+	/**
+	 * Sets the host directory that all the filesystem paths are relative to. An empty root directory, which is the
+	 * default, resolves the paths relative to the current working directory of the process, and rejects absolute
+	 * paths, since nothing would confine them.
+	 * @param rootDirectory The path of the root directory on the host, without a trailing '/'
+	 */
+	void setRootDirectory(const RootDirectory& rootDirectory);
+
+	/**
+	 * @return The host directory that all the filesystem paths are relative to
+	 */
+	const RootDirectory& getRootDirectory();
+} // namespace Filesystem
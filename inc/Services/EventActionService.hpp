@@ -1,10 +1,11 @@
 #ifndef ECSS_SERVICES_EVENTACTIONSERVICE_HPP
 #define ECSS_SERVICES_EVENTACTIONSERVICE_HPP
 
+#include "Helpers/EventIndexedMap.hpp"
 #include "Service.hpp"
 #include "Services/EventReportService.hpp"
 #include "etl/String.hpp"
-#include "etl/multimap.h"
+#include "etl/queue.h"
 
 /**
  * Implementation of ST[19] event-action Service
@@ -24,6 +25,16 @@ private:
 	 */
 	bool eventActionFunctionStatus = false;
 
+	/**
+	 * The events whose actions have not been executed yet, in the order in which they occurred
+	 */
+	etl::queue<EventDefinitionId, ECSSEventActionQueueSize> pendingActions;
+
+	/**
+	 * The number of actions that were not executed because the queue of pending actions was full
+	 */
+	uint16_t droppedActionCount = 0;
+
 public:
 	inline static const ServiceTypeNum ServiceType = 19;
 
@@ -46,13 +57,39 @@ public:
 		String<ECSSTCRequestStringSize> request = "";
 		bool enabled = false;
 
+		/**
+		 * The size of the application data of the request, i.e. what follows its TC secondary header
+		 */
+		inline static constexpr uint8_t ActionDataSize = ECSSTCRequestStringSize - ECSSSecondaryTCHeaderSize;
+
+		/**
+		 * The fields of the TC secondary header of the request, decoded once when the definition is added
+		 */
+		ServiceTypeNum actionServiceType = 0;
+		MessageTypeNum actionMessageType = 0;
+		SourceId actionSourceId = 0;
+		/**
+		 * False if the request does not start with a valid TC secondary header. Such requests are still executed, but
+		 * are reported as unacceptable whenever the event occurs, as MessageParser::parseECSSTC does.
+		 */
+		bool actionHeaderIsValid = false;
+
 		EventActionDefinition(ApplicationProcessId applicationID, EventDefinitionId eventDefinitionID, Message& message);
+
+		/**
+		 * Fills a new Message with the TC that is executed when the event occurs, with the same fields that
+		 * MessageParser::parseECSSTC would set from the request.
+		 */
+		void buildAction(Message& action) const;
 	};
 
 	friend EventReportService;
 
-	etl::multimap<uint16_t, EventActionDefinition, ECSSEventActionStructMapSize>
-	    eventActionDefinitionMap;
+	/**
+	 * The event-action definitions, indexed by their event definition ID. There is at most one definition per event,
+	 * since adding a definition for an event replaces the existing disabled one.
+	 */
+	EventIndexedMap<EventActionDefinition, ECSSEventActionStructMapSize> eventActionDefinitionMap;
 
 	EventActionService() : eventActionFunctionStatus(true) {
 		serviceType = ServiceType;
@@ -119,11 +156,36 @@ public:
 	}
 
 	/**
-	 * Custom function that is called right after an event takes place, to initiate
-	 * the execution of the action
+	 * Executes the action of an event immediately, if its event-action definition is enabled
 	 */
 	void executeAction(EventDefinitionId eventDefinitionID);
 
+	/**
+	 * Called right after an event takes place. The action of the event is not executed here, but is queued to be
+	 * executed by the next call to executePendingActions(), so that raising an event stays cheap and the action does
+	 * not run inside the call stack that reported the event.
+	 *
+	 * Events without an enabled event-action definition are not queued. If the queue is full, the action is dropped
+	 * and counted in getDroppedActionCount().
+	 */
+	void queueAction(EventDefinitionId eventDefinitionID);
+
+	/**
+	 * Executes the actions that were queued until now, in the order in which their events occurred. Actions queued
+	 * by events that are raised while executing them are left for the next call.
+	 *
+	 * @note This should be called periodically by the platform, outside of any event reporting.
+	 */
+	void executePendingActions();
+
+	uint8_t getPendingActionCount() const {
+		return pendingActions.size();
+	}
+
+	uint16_t getDroppedActionCount() const {
+		return droppedActionCount;
+	}
+
 	/**
 	 * It is responsible to call the suitable function that executes a telecommand packet. The source of that packet
 	 * is the ground station.
@@ -1,7 +1,10 @@
 #ifndef ECSS_SERVICES_EVENTREPORTSERVICE_HPP
 #define ECSS_SERVICES_EVENTREPORTSERVICE_HPP
 
+#include <atomic>
+#include <etl/array.h>
 #include <etl/bitset.h>
+#include "Helpers/MPSCQueue.hpp"
 #include "Service.hpp"
 
 /**
@@ -15,8 +18,13 @@
  */
 
 class EventReportService : public Service {
-private:
+public:
+	/**
+	 * The number of events, whose IDs are 0 to numberOfEvents - 1
+	 */
 	static const uint16_t numberOfEvents = 7;
+
+private:
 	etl::bitset<numberOfEvents> stateOfEvents;
 
 public:
@@ -49,6 +57,15 @@ public:
 	uint16_t lastMediumSeverityReportID = 65535;
 	uint16_t lastHighSeverityReportID = 65535;
 
+	// Variables that count the event reports that were suppressed by rate limiting, per severity level
+	uint16_t informativeSuppressedCount = 0;
+	uint16_t lowSeveritySuppressedCount = 0;
+	uint16_t mediumSeveritySuppressedCount = 0;
+	uint16_t highSeveritySuppressedCount = 0;
+
+	// The number of reports that were generated for coalesced occurrences of an event
+	uint16_t coalescedReportCount = 0;
+
 	EventReportService() {
 		stateOfEvents.set();
 		serviceType = ServiceType;
@@ -92,7 +109,18 @@ public:
 		/**
 		 * When an execution of a notification/event fails to start
 		 */
-		FailedStartOfExecution = 7
+		FailedStartOfExecution = 7,
+		/**
+		 * Occurrences of another event were suppressed by rate limiting. This event is only reported by the service
+		 * itself, in the coalesced reports of @ref updateRateLimits, and cannot be raised, enabled or disabled.
+		 *
+		 * The report has the message type of the suppressed event, and its auxiliary data are:
+		 * - the EventDefinitionId of the suppressed event
+		 * - the number of suppressed occurrences, as a uint16_t (saturated at 65535)
+		 * - the time of the first suppressed occurrence, as a default CUC timestamp
+		 * - the time of the last suppressed occurrence, as a default CUC timestamp
+		 */
+		SuppressedEventOccurrences = 8
 	};
 
 	/**
@@ -165,6 +193,91 @@ public:
 	 */
 	void listOfDisabledEventsReport();
 
+	/**
+	 * Raises an event, to be reported later by processRaisedEvents(). Unlike the report functions, this only copies the
+	 * event into a lock-free queue, so it can be called concurrently from any task or interrupt handler, as long as
+	 * TimeGetter can be called from there.
+	 *
+	 * @param eventID event definition ID, lower than numberOfEvents
+	 * @param reportType The report type of the severity of the event, from InformativeEventReport to
+	 * HighSeverityAnomalyReport
+	 * @param data the data of the report
+	 * @return False if the event was dropped because the queue of raised events is full, or rejected because its ID or
+	 * report type is out of range. No error is reported for rejected events, since this may run in an interrupt.
+	 */
+	bool raiseEvent(Event eventID, MessageType reportType, const String<ECSSEventDataAuxiliaryMaxSize>& data);
+
+	/**
+	 * Reports the raised events in the order in which they were raised, as if the matching report function had been
+	 * called at that point. Must only be called by a single task.
+	 *
+	 * @param maximumEvents The maximum number of events to report in this call
+	 * @return The number of events that were reported
+	 */
+	size_t processRaisedEvents(size_t maximumEvents = ECSSRaisedEventQueueSize);
+
+	/**
+	 * @return The number of raised events that have not been reported yet
+	 */
+	size_t getRaisedEventCount() const {
+		return raisedEvents.size();
+	}
+
+	/**
+	 * @return The number of raised events that were lost because the queue was full
+	 */
+	uint16_t getDroppedRaisedEventCount() const {
+		return droppedRaisedEventCount.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Sets the rate limit of the reports of one severity level. Rate limiting is disabled by default.
+	 *
+	 * @param reportType The report type of the severity level, from InformativeEventReport to
+	 * HighSeverityAnomalyReport
+	 * @param burstSize The maximum number of reports of an event that are generated in a burst, or zero to disable
+	 * rate limiting
+	 * @param refillInterval The time after which one more report of an event can be generated, in milliseconds
+	 */
+	void setRateLimit(MessageType reportType, uint16_t burstSize, TimeStamps refillInterval);
+
+	/**
+	 * Regains the tokens of the rate-limited events, and generates the coalesced reports of the events that have a
+	 * token available again. At most one coalesced report is generated per event and call.
+	 *
+	 * @note This should be called periodically by the platform. No tokens are regained between calls.
+	 *
+	 * @param currentTime The current system time, in milliseconds.
+	 * @return The minimum amount of time until an event regains a token, in milliseconds.
+	 */
+	TimeStamps updateRateLimits(TimeStamps currentTime);
+
+	/**
+	 * Sets the report type of an event, i.e. its severity, which eventReport() uses. Every event starts with the
+	 * report type that its definition implies, and anomalies that are not named after a severity are of low severity.
+	 *
+	 * @param reportType The report type of the severity of the event, from InformativeEventReport to
+	 * HighSeverityAnomalyReport
+	 * @return False if the event ID or the report type is out of range, in which case nothing is changed
+	 */
+	bool setEventReportType(Event eventID, MessageType reportType);
+
+	/**
+	 * @return The report type of an event, as set with setEventReportType()
+	 */
+	MessageType getEventReportType(Event eventID) const {
+		return eventReportTypes[eventID];
+	}
+
+	/**
+	 * Reports an event with the report type that is set for it, for services that report events chosen by the ground,
+	 * such as the check transitions of ST[12]. Events whose ID is out of range are ignored.
+	 *
+	 * @param eventID event definition ID, lower than numberOfEvents
+	 * @param data the data of the report
+	 */
+	void eventReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data);
+
 	/**
 	 * Getter for stateOfEvents bitset
 	 * @return stateOfEvents, just in case the whole bitset is needed
@@ -181,6 +294,114 @@ public:
 	 * @param message Contains the necessary parameters to call the suitable subservice
 	 */
 	void execute(Message& message);
+
+private:
+	/**
+	 * The number of report types that can be rate limited, from TM[5,1] to TM[5,4]
+	 */
+	static const uint8_t numberOfSeverities = 4;
+
+	/**
+	 * The rate limit of the reports of one severity level.
+	 *
+	 * Every event has a token bucket that holds up to burstSize tokens. Each report of the event spends one token, and
+	 * one token is regained every refillInterval. While the bucket is empty, the occurrences of the event are not
+	 * reported one by one, but are coalesced into a single report once a token is available again.
+	 */
+	struct EventRateLimit {
+		/**
+		 * The maximum number of reports of an event that are generated in a burst. Zero disables rate limiting.
+		 */
+		uint16_t burstSize = 0;
+		/**
+		 * The time needed to regain one token, in milliseconds
+		 */
+		TimeStamps refillInterval = 0;
+	};
+
+	/**
+	 * The rate limiting state of a single event
+	 */
+	struct EventRateState {
+		uint16_t usedTokens = 0;
+		/**
+		 * The time when a token was last regained, in milliseconds
+		 */
+		TimeStamps lastRefillTime = 0;
+		/**
+		 * The report type of the latest occurrence of the event, which selects the rate limit of the event
+		 */
+		MessageTypeNum reportType = 0;
+		/**
+		 * The number of occurrences of the event that have not been reported yet
+		 */
+		uint16_t suppressedOccurrences = 0;
+		Time::DefaultCUC firstSuppressedTime;
+		Time::DefaultCUC lastSuppressedTime;
+	};
+
+	/**
+	 * The report type of every event, indexed by its ID
+	 */
+	etl::array<MessageType, numberOfEvents> eventReportTypes = {InformativeEventReport, LowSeverityAnomalyReport,
+	                                                            LowSeverityAnomalyReport, InformativeEventReport,
+	                                                            LowSeverityAnomalyReport, MediumSeverityAnomalyReport,
+	                                                            HighSeverityAnomalyReport};
+
+	etl::array<EventRateLimit, numberOfSeverities> rateLimits;
+	etl::array<EventRateState, numberOfEvents> rateStates;
+
+	/**
+	 * The time of the latest call to updateRateLimits(), in milliseconds
+	 */
+	TimeStamps rateLimitTime = 0;
+
+	/**
+	 * An event that was raised with raiseEvent(), and has not been reported yet
+	 */
+	struct EventRecord {
+		EventDefinitionId eventID = 0;
+		MessageTypeNum reportType = 0;
+		uint8_t dataSize = 0;
+		etl::array<uint8_t, ECSSEventDataAuxiliaryMaxSize> data{};
+		Time::DefaultCUC occurrenceTime;
+	};
+
+	MPSCQueue<EventRecord, ECSSRaisedEventQueueSize> raisedEvents;
+
+	/**
+	 * The number of raised events that were lost because the queue was full
+	 */
+	std::atomic<uint16_t> droppedRaisedEventCount{0};
+
+	/**
+	 * Decides whether an occurrence of an event is reported, and spends a token of the event if it is. Otherwise, the
+	 * occurrence is recorded to be reported later in a coalesced report.
+	 *
+	 * @param occurrenceTime The time when the event occurred, or nullptr if it occurred now
+	 * @return True if the report of the event should be generated now
+	 */
+	bool admitEventReport(Event eventID, MessageType reportType, const Time::DefaultCUC* occurrenceTime);
+
+	/**
+	 * Counts an occurrence of an event, and generates its report of the given type, unless the event is disabled or
+	 * its report is suppressed by rate limiting.
+	 *
+	 * @param occurrenceTime The time when the event occurred, or nullptr if it occurred now
+	 */
+	void reportEvent(Event eventID, MessageType reportType, const String<ECSSEventDataAuxiliaryMaxSize>& data,
+	                 const Time::DefaultCUC* occurrenceTime);
+
+	/**
+	 * @return The counter of suppressed reports of a severity level
+	 */
+	uint16_t& suppressedReportCount(MessageTypeNum reportType);
+
+	/**
+	 * Stores a report of the SuppressedEventOccurrences event, with the message type of the suppressed event, for the
+	 * occurrences of that event that were suppressed.
+	 */
+	void coalescedEventReport(EventDefinitionId eventID, EventRateState& state);
 };
 
 #endif // ECSS_SERVICES_EVENTREPORTSERVICE_HPP
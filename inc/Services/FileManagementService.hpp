@@ -34,6 +34,23 @@ public:
 	 */
 	inline static constexpr size_t MaxPossibleFileSizeBytes = 4096;
 
+	/**
+	 * The maximum number of bytes of file content carried by a single TM[23,27] report. Together with the repository
+	 * path and file name, a report always fits in ECSSMaxMessageSize.
+	 */
+	inline static constexpr uint16_t MaxFileChunkSize = 512;
+
+	/**
+	 * The maximum number of directory levels below the repository that a file search enters
+	 */
+	inline static constexpr uint8_t MaxSearchDepth = 8;
+
+	/**
+	 * The maximum number of objects that a file search or a directory summary reports. Any further objects are not
+	 * reported.
+	 */
+	inline static constexpr uint16_t MaxReportedObjects = 256;
+
 	enum MessageType : uint8_t {
 		CreateFile = 1,
 		DeleteFile = 2,
@@ -58,7 +75,12 @@ public:
 		AbortFileCopyOperationInPath = 21,
 		EnablePeriodicReportingOfFileCopy = 22,
 		FileCopyStatusReport = 23,
-		DisablePeriodicReportingOfFileCopy = 24
+		DisablePeriodicReportingOfFileCopy = 24,
+		// Mission-specific message types, not defined by ECSS
+		WriteFileContent = 25,
+		ReadFileContent = 26,
+		FileContentReport = 27,
+		TransferFileToPacketStore = 28
 	};
 
 	/**
@@ -100,6 +122,28 @@ public:
      */
 	void fileAttributeReport(const Filesystem::ObjectPath& repositoryPath, const Filesystem::ObjectPath& fileName, const Filesystem::Attributes& attributes);
 
+	/**
+	 * TC[23,7] Find the files under the provided repository path whose path, relative to the repository, matches the
+	 * provided search pattern. The search enters at most MaxSearchDepth levels of directories, and stops after
+	 * MaxReportedObjects files are found.
+	 * Checks done prior to searching:
+	 * - The repository's path does not contain a wildcard
+	 * - The repository path leads to an existing directory
+	 *
+	 * The found files are reported with TM[23,8] reports while the search goes on, so that only the report being
+	 * filled is kept in memory.
+	 */
+	void findFiles(Message& message);
+
+	/**
+	 * TC[23,12] Report a summary of the objects in the directory at the provided repository path and directory path,
+	 * with TM[23,13] reports. At most MaxReportedObjects objects are reported.
+	 * Checks done prior to reporting a directory:
+	 * - The repository's path and directory's path do not contain a wildcard
+	 * - The path leads to an existing directory
+	 */
+	void reportSummaryDirectory(Message& message);
+
 	/**
      * TC[23,9] Create a directory on the filesystem
      */
@@ -110,6 +154,40 @@ public:
      */
 	void deleteDirectory(Message& message){};
 
+	/**
+	 * TC[23,25] Write data to a file at the provided repository path and file name, starting at the provided offset
+	 * Checks done prior to writing to a file:
+	 * - The repository's path and file's name do not contain a wildcard
+	 * - The path leads to an existing file
+	 * - The data does not extend the file beyond MaxPossibleFileSizeBytes
+	 * - The file is not locked
+	 *
+	 * The data is written straight from the TC, without being copied.
+	 */
+	void writeFileContent(Message& message);
+
+	/**
+	 * TC[23,26] Read the content of a file at the provided repository path and file name, from the provided offset
+	 * and for the provided number of bytes, or until the end of the file if the number of bytes is 0. The content is
+	 * reported with TM[23,27] reports of at most MaxFileChunkSize bytes each.
+	 * Checks done prior to reading a file:
+	 * - The repository's path and file's name do not contain a wildcard
+	 * - The path leads to an existing file
+	 * - The offset is not after the end of the file
+	 */
+	void readFileContent(Message& message);
+
+	/**
+	 * TC[23,28] Transfer the whole content of a file at the provided repository path and file name to the provided
+	 * packet store of ST[15], as TM[23,27] reports of at most MaxFileChunkSize bytes each.
+	 * Checks done prior to transferring a file:
+	 * - The repository's path and file's name do not contain a wildcard
+	 * - The path leads to an existing file
+	 * - The packet store exists and its storage status is enabled
+	 * - The packet store has room for all the reports of the file, both in packets and in its size in bytes
+	 */
+	void transferFileToPacketStore(Message& message);
+
 	/**
 	 * It is responsible to call the suitable function that executes a tele-command packet. The source of that packet
 	 * is the ground station.
@@ -123,6 +201,41 @@ private:
 	using ObjectPath = Filesystem::ObjectPath;
 	using Path = Filesystem::Path;
 
+	/**
+	 * Reads the repository path and the file name of a file content TC, and checks that they lead to a file,
+	 * reporting an error otherwise
+	 * @return The full path of the file, or nothing if an error was reported
+	 */
+	etl::optional<Path> readFileContentPath(Message& message, ObjectPath& repositoryPath, ObjectPath& fileName);
+
+	class ObjectListReport;
+
+	/**
+	 * Walks the directory tree under a directory, depth first, entering at most MaxSearchDepth levels of
+	 * subdirectories. The path of every object is built in place in \p path, so the walk only needs one directory
+	 * stream per level. Objects whose path does not fit in a Path are skipped.
+	 * @param path The path of the directory, which is restored when the walk returns
+	 * @param depth The number of levels of subdirectories between the start of the walk and \p path, i.e. 0 when the
+	 * walk starts
+	 * @param visitor Called with each object, as `visitor(const Path& path, Filesystem::NodeType type)`. Returning
+	 * false stops the walk.
+	 * @return False if the walk was stopped by the visitor
+	 */
+	template <typename Visitor>
+	bool walkDirectory(Path& path, uint8_t depth, Visitor& visitor);
+
+	/**
+	 * Reads a file in chunks of at most MaxFileChunkSize bytes, straight into TM[23,27] reports, so that the file is
+	 * never staged in memory as a whole. Even an empty range produces a single, empty report.
+	 * @param start The position in the file of the first byte to report
+	 * @param end The position in the file after the last byte to report
+	 * @param sink Called with each report, as `sink(Message& report)`
+	 * @return False if the file could not be read, in which case an error is reported
+	 */
+	template <typename Sink>
+	bool streamFileContent(Message& request, const Path& path, const ObjectPath& repositoryPath, const ObjectPath& fileName,
+	                       size_t start, size_t end, Sink&& sink);
+
 	/**
 	 * Returns the full filesystem path for an object given the repository path and the file path
 	 * @param repositoryPath The repository path
@@ -2,13 +2,23 @@
 #define ECSS_SERVICES_LARGEPACKETTRANSFERSERVICE_HPP
 
 #include <etl/String.hpp>
+#include "Helpers/Filesystem.hpp"
+#include "Helpers/LargePacketReassembler.hpp"
 #include "Service.hpp"
+#include "etl/span.h"
+
+class PacketStore;
 
 /**
  * Implementation of the ST[13] large packet transfer service
  * The goal of this service is to help in splitting data packages that exceed the standard's
  * maximum data size
  *
+ * Payloads of any size, read from a buffer, a file or a packet store, are downlinked in parts of PartSize bytes. Every
+ * part is read straight into its TM packet, so a payload is never copied into an intermediate buffer. Uplinked parts
+ * are reassembled by a LargePacketReassembler, which accepts them in any order and abandons transactions that stop
+ * receiving parts.
+ *
  * Note: More information can be found in the standards' manual, in p. 526-528 and in p. 229-236
  *
  * @ingroup Services
@@ -23,8 +33,55 @@ public:
 		FirstDownlinkPartReport = 1,
 		InternalDownlinkPartReport = 2,
 		LastDownlinkPartReport = 3,
+		FirstUplinkPart = 9,
+		IntermediateUplinkPart = 10,
+		LastUplinkPart = 11,
 	};
 
+	/**
+	 * The size of every part of a large packet except the last one, in bytes
+	 */
+	static constexpr uint16_t PartSize = ECSSMaxFixedOctetStringSize;
+
+	using Reassembler = LargePacketReassembler<ECSSMaxLargePacketTransactions, ECSSMaxLargePacketSize, PartSize>;
+
+private:
+	/**
+	 * The large packets that are being uplinked
+	 */
+	Reassembler reassembler;
+
+	/**
+	 * Downlinks a payload as TM[13,1], TM[13,2] and TM[13,3] parts. A payload that fits in a single part is sent as
+	 * a single TM[13,3] part with the part sequence number 0, and an empty payload is not sent at all.
+	 *
+	 * @param payloadSize The size of the payload, in bytes
+	 * @param readPart Fills the data of the next part straight in its TM packet, called as `readPart(span)` with
+	 * consecutive parts of the payload. Returning false stops the transfer.
+	 * @return Whether the whole payload was sent
+	 */
+	template <typename PartReader>
+	bool splitPayload(LargeMessageTransactionId largeMessageTransactionIdentifier, size_t payloadSize,
+	                  PartReader&& readPart);
+
+	/**
+	 * Stores an uplinked part of a large packet, from TC[13,9], TC[13,10] or TC[13,11]
+	 */
+	void receiveUplinkPart(Message& message, Reassembler::PartType partType);
+
+	/**
+	 * Called with every large packet that has been completely uplinked. The platform decides what the packet is, and
+	 * what to do with it. The transaction of the packet is already released, so the platform may execute ST[13]
+	 * requests from here.
+	 * @param packet The reassembled packet, which is only valid until the next uplink part is received
+	 * @return Whether the platform could use the packet. Otherwise, the request that carried the part completing the
+	 * packet fails with a LargePacketNotAccepted completion error.
+	 */
+	bool largePacketReassembled(LargeMessageTransactionId largeMessageTransactionIdentifier,
+	                            etl::span<const uint8_t> packet);
+
+public:
+
 	/**
 	 * Default constructor since only functions will be used.
 	 */
@@ -59,27 +116,35 @@ public:
 	void lastDownlinkPartReport(LargeMessageTransactionId largeMessageTransactionIdentifier, PartSequenceNum partSequenceNumber,
 	                            const String<ECSSMaxFixedOctetStringSize>& string);
 
-	// The three uplink functions should handle a TC request to "upload" data. Since there is not
-	// a composeECSS function ready, I just return the given string.
-	// @TODO: Modify these functions properly
 	/**
-	 * TC[13,9] Function that handles the first part of the uplink request
-	 * @param string This will change when these function will be modified
+	 * TC[13,9] first uplink part
+	 * Starts, or continues if parts have arrived out of order, the reassembly of a large packet
+	 * @param message The TC, containing the large message transaction identifier, the part sequence number and the
+	 * part as an octet string
+	 */
+	void firstUplinkPart(Message& message);
+
+	/**
+	 * TC[13,10] intermediate uplink part
+	 * @param message The TC, containing the large message transaction identifier, the part sequence number and the
+	 * part as an octet string
 	 */
-	static String<ECSSMaxFixedOctetStringSize> firstUplinkPart(const String<ECSSMaxFixedOctetStringSize>& string);
+	void intermediateUplinkPart(Message& message);
 
 	/**
-	 * TC[13,10] Function that handles the n-2 parts of the n-part uplink request
-	 * @param string This will change when these function will be modified
+	 * TC[13,11] last uplink part
+	 * Once all the parts of a large packet have arrived, the packet is handed over to the platform.
+	 * @param message The TC, containing the large message transaction identifier, the part sequence number and the
+	 * part as an octet string
 	 */
-	static String<ECSSMaxFixedOctetStringSize>
-	intermediateUplinkPart(const String<ECSSMaxFixedOctetStringSize>& string);
+	void lastUplinkPart(Message& message);
 
 	/**
-	 * TC[13,11] Function that handles the last part of the uplink request
-	 * @param string This will change when these function will be modified
+	 * Abandons the uplink transactions that have not received any part for ECSSLargePacketReassemblyTimeout. This is
+	 * also done whenever an uplink part arrives.
+	 * @return The number of abandoned transactions
 	 */
-	static String<ECSSMaxFixedOctetStringSize> lastUplinkPart(const String<ECSSMaxFixedOctetStringSize>& string);
+	size_t expireUplinkTransactions();
 
 	/**
 	 * Function that splits large messages
@@ -87,6 +152,43 @@ public:
 	 * @param largeMessageTransactionIdentifier that is a value we assign to this splitting of the large message
 	 */
 	void split(Message& message, LargeMessageTransactionId largeMessageTransactionIdentifier);
+
+	/**
+	 * Downlinks a buffer in parts
+	 * @param payload The bytes to send, which are copied straight into the TM packets
+	 * @param largeMessageTransactionIdentifier that is a value we assign to this splitting of the payload
+	 * @return Whether the payload was sent, i.e. it does not need more parts than a part sequence number can count
+	 */
+	bool split(etl::span<const uint8_t> payload, LargeMessageTransactionId largeMessageTransactionIdentifier);
+
+	/**
+	 * Downlinks the content of a file in parts. Every part is read from the file straight into its TM packet, so the
+	 * file is never held in memory.
+	 * @param path The path of the file on the filesystem
+	 * @param largeMessageTransactionIdentifier that is a value we assign to this splitting of the file
+	 * @return Whether the whole file was sent. If the file cannot be read after the first parts, the remaining parts
+	 * are not sent.
+	 */
+	bool splitFile(const Filesystem::Path& path, LargeMessageTransactionId largeMessageTransactionIdentifier);
+
+	/**
+	 * Downlinks the packets of a packet store in parts. Each stored packet becomes its time-tag (uint32), service
+	 * type (uint8), message type (uint8), data length (uint16) and data, and the packets follow each other from the
+	 * oldest to the newest.
+	 * @param packetStore The packet store, whose packets are read straight into the TM packets
+	 * @param largeMessageTransactionIdentifier that is a value we assign to this splitting of the packet store
+	 * @return Whether the packet store was sent
+	 */
+	bool splitPacketStore(const PacketStore& packetStore, LargeMessageTransactionId largeMessageTransactionIdentifier);
+
+	/**
+	 * It is responsible to call the suitable function that executes a telecommand packet. The source of that packet
+	 * is the ground station.
+	 *
+	 * @note This function is called from the main execute() that is defined in the file MessageParser.hpp
+	 * @param message Contains the necessary parameters to call the suitable subservice
+	 */
+	void execute(Message& message);
 };
 
 #endif // ECSS_SERVICES_LARGEPACKETTRANSFERSERVICE_HPP
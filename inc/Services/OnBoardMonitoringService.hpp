@@ -9,6 +9,10 @@
 #include "ECSS_Definitions.hpp"
 #include "etl/list.h"
 #include "Helpers/PMONBase.hpp"
+#include "Helpers/PMONLimitCheckBatch.hpp"
+#include "Helpers/TimeGetter.hpp"
+#include "etl/optional.h"
+#include "etl/vector.h"
 
 /**
  * Implementation of the ST[12] parameter statistics reporting service, as defined in ECSS-E-ST-70-41C.
@@ -18,9 +22,111 @@
 class OnBoardMonitoringService : public Service {
 private:
 	/**
-	 * Map storing the parameter monitoring definitions.
+	 * Map storing the parameter monitoring definitions. The definitions are owned by the service, so that they can be
+	 * added, modified and deleted by telecommands without any dynamic allocation.
 	 */
-	etl::map<uint16_t, std::reference_wrapper<PMONBase>, ECSSMaxMonitoringDefinitions> parameterMonitoringList;
+	etl::map<PMONId, PMONVariant, ECSSMaxMonitoringDefinitions> parameterMonitoringList;
+
+	/**
+	 * Reads the check type specific part of a Parameter Monitoring definition from a TC[12,5] or TC[12,7], and
+	 * constructs the definition if it is valid. The whole definition is always consumed from the message, so that the
+	 * next one can be read even if this one is rejected.
+	 *
+	 * @return The new definition, or an empty optional if an error was reported.
+	 */
+	etl::optional<PMONVariant> readPMONDefinition(Message& message, ParameterId monitoredParameterId,
+	                                              uint16_t repetitionNumber, PMONBase::CheckType checkType);
+
+	/**
+	 * Appends a Parameter Monitoring definition to a TM[12,9], in the same format as in TC[12,5].
+	 */
+	static void appendPMONDefinition(Message& report, PMONId id, PMONVariant& PMONDefinition);
+
+	/**
+	 * All the limit checks of the parameter monitoring list, in the order of the list, evaluated together as a batch.
+	 */
+	PMONLimitCheckBatch<ECSSMaxMonitoringDefinitions> limitCheckBatch;
+
+	/**
+	 * Whether the parameter monitoring list has changed since limitCheckBatch was built
+	 */
+	bool limitCheckBatchOutdated = true;
+
+	/**
+	 * A Parameter Monitoring definition that occupies a slot of limitCheckBatch
+	 */
+	struct BatchedLimitCheck {
+		PMONId id;
+		PMONBase* definition;
+	};
+
+	/**
+	 * The definitions corresponding to each slot of limitCheckBatch
+	 */
+	etl::array<BatchedLimitCheck, ECSSMaxMonitoringDefinitions> limitCheckBatchDefinitions;
+
+	/**
+	 * Assigns a slot of limitCheckBatch to every limit check of the parameter monitoring list. Called when the list
+	 * has changed, since the slots refer to the definitions stored in the list.
+	 */
+	void rebuildLimitCheckBatch();
+
+	/**
+	 * A change of the checking status of a Parameter Monitoring definition, waiting to be reported in a TM[12,12].
+	 */
+	struct CheckTransition {
+		PMONId id;
+		ParameterId monitoredParameterId;
+		PMONBase::CheckType checkType;
+		/**
+		 * The expected value, limit or threshold that was crossed, or zero for transitions within limits or thresholds
+		 */
+		double limitCrossed;
+		double parameterValue;
+		PMONBase::CheckingStatus previousStatus;
+		PMONBase::CheckingStatus currentStatus;
+		Time::DefaultCUC transitionTime;
+	};
+
+	/**
+	 * The check transitions that have not been reported yet
+	 */
+	etl::vector<CheckTransition, ECSSMaxCheckTransitionsPerReport> checkTransitionBuffer;
+
+	/**
+	 * The time when the oldest buffered check transition has to be reported, in milliseconds
+	 */
+	TimeStamps checkTransitionReportDeadline = 0;
+
+	/**
+	 * The maximum number of check transitions that have been in the buffer at the same time
+	 */
+	uint16_t checkTransitionHighWaterMark = 0;
+
+	/**
+	 * Stores the latest transition of a Parameter Monitoring definition in the check transition buffer. The buffer is
+	 * reported in a TM[12,12] as soon as it is full, so that no transition is lost.
+	 *
+	 * @param checkedValue The parameter value that the check was performed on
+	 */
+	void recordCheckTransition(PMONId PMONId, const PMONBase& PMONDefinition, double checkedValue,
+	                           TimeStamps currentTime);
+
+	/**
+	 * Applies the repetition counting to a new check result of a definition, and raises the configured event if a new
+	 * out-of-limits status is confirmed.
+	 *
+	 * @param checkedValue The parameter value that produced \p checkResult
+	 * @return true if the checking status of the definition changed.
+	 */
+	bool applyCheckResult(PMONId PMONId, PMONBase& PMONDefinition, PMONBase::CheckingStatus checkResult,
+	                      double checkedValue, TimeStamps currentTime);
+
+	/**
+	 * Raises the event that is configured for the new checking status of a Parameter Monitoring definition, if any.
+	 * The event is reported with the severity that ST[5] sets for it.
+	 */
+	void raiseCheckTransitionEvent(PMONId PMONId, const PMONBase& PMONDefinition);
 
 public:
 	inline static const ServiceTypeNum ServiceType = 12;
@@ -55,17 +161,30 @@ public:
 	 */
 	bool parameterMonitoringFunctionStatus = false;
 	/*
-	 * Adds a new Parameter Monitoring definition to the parameter monitoring list.
+	 * Adds a copy of a Parameter Monitoring definition to the parameter monitoring list.
 	 */
-	void addPMONDefinition(PMONId PMONId, std::reference_wrapper<PMONBase> PMONDefinition) {
+	void addPMONDefinition(PMONId PMONId, const PMONVariant& PMONDefinition) {
 		parameterMonitoringList.insert({PMONId, PMONDefinition});
+		limitCheckBatchOutdated = true;
 	}
 	/**
 	 * @param PMONId
 	 * @return Parameter Monitoring definition
 	 */
 	std::reference_wrapper<PMONBase> getPMONDefinition(PMONId PMONId) {
-		return parameterMonitoringList.at(PMONId);
+		return getPMONBase(parameterMonitoringList.at(PMONId));
+	}
+	/**
+	 * @return true if a Parameter Monitoring definition with this id exists
+	 */
+	bool hasPMONDefinition(PMONId PMONId) const {
+		return parameterMonitoringList.find(PMONId) != parameterMonitoringList.end();
+	}
+	/**
+	 * @return The number of Parameter Monitoring definitions in the list
+	 */
+	size_t getPMONDefinitionCount() const {
+		return parameterMonitoringList.size();
 	}
 	/**
 	 * @return true if PMONList is empty.
@@ -95,6 +214,83 @@ public:
 	 */
 	void deleteAllParameterMonitoringDefinitions(Message& message);
 
+	/**
+	 * TC[12,5]
+	 * Adds new PMON definitions to the PMON list. Each definition consists of the PMON id, the monitored parameter
+	 * id, the monitoring interval, the repetition number, the check type and the check type specific fields.
+	 */
+	void addParameterMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,6]
+	 * Deletes the PMON definitions which correspond to the ids in the request. Enabled definitions are not deleted.
+	 */
+	void deleteParameterMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,7]
+	 * Replaces existing PMON definitions, in the same format as TC[12,5]. The checking status of each modified
+	 * definition is reset, while its monitoring status is kept.
+	 */
+	void modifyParameterMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,8]
+	 * Requests a TM[12,9] report of the PMON definitions which correspond to the ids in the request.
+	 */
+	void reportParameterMonitoringDefinitions(Message& message);
+
+	/**
+	 * Checks every enabled Parameter Monitoring definition whose monitoring interval has elapsed, and raises the
+	 * configured event for each confirmed transition to an out-of-limits status. Nothing is checked while the
+	 * parameter monitoring function is disabled.
+	 *
+	 * The due limit checks are evaluated together in a \ref PMONLimitCheckBatch, and only the ones whose result
+	 * differs from their current status go through the repetition counting. The limit checks are therefore processed
+	 * after all the other checks of the cycle, so their events and check transitions come after the ones of the
+	 * expected value and delta checks.
+	 *
+	 * Check transitions are buffered, and reported together in a TM[12,12] as soon as the buffer is full, or at the end
+	 * of the call when the maximum transition reporting delay has elapsed since the oldest buffered transition. No
+	 * transition is dropped, so a call that checks many definitions may generate more than one TM[12,12].
+	 *
+	 * @note Definitions with a zero monitoring interval are checked on every call, but do not affect the returned time.
+	 *
+	 * @param currentTime The current system time, in milliseconds.
+	 * @return The minimum amount of time until the next check or check transition report is due, in milliseconds.
+	 */
+	TimeStamps checkPendingDefinitions(TimeStamps currentTime);
+
+	/**
+	 * Constructs and stores a TM[12,12] check transition report with all the buffered check transitions, and empties
+	 * the buffer.
+	 */
+	void checkTransitionReport();
+
+	/**
+	 * @return The number of check transitions waiting to be reported
+	 */
+	size_t getPendingCheckTransitionCount() const {
+		return checkTransitionBuffer.size();
+	}
+
+	/**
+	 * @return The maximum number of check transitions that have been buffered at the same time
+	 */
+	uint16_t getCheckTransitionHighWaterMark() const {
+		return checkTransitionHighWaterMark;
+	}
+
+	/**
+	 * Performs a single check of a Parameter Monitoring definition against the current value of its monitored
+	 * parameter, updates its checking status and raises the configured event if a new out-of-limits status is
+	 * confirmed. A new checking status is also stored in the check transition buffer.
+	 *
+	 * @param currentTime The current system time, in milliseconds.
+	 * @return true if the checking status of the definition changed.
+	 */
+	bool checkParameterMonitoringDefinition(PMONId PMONId, PMONBase& PMONDefinition, TimeStamps currentTime);
+
 	void execute(Message& message);
 };
 
@@ -8,6 +8,7 @@
 #include "Service.hpp"
 #include "etl/deque.h"
 #include "etl/map.h"
+#include "etl/vector.h"
 
 /**
  * Implementation of the ST[04] parameter statistics reporting service, as defined in ECSS-E-ST-70-41C.
@@ -33,11 +34,65 @@ private:
 	 */
 	SamplingInterval reportingIntervalMs = 700;
 
+	/**
+	 * A set of statistics that share the same sampling interval. The due time of each group is evaluated once per
+	 * sampling pass, instead of once per statistic.
+	 */
+	struct SamplingGroup {
+		SamplingInterval samplingInterval = 0;
+		TimeStamps nextSamplingTime = 0;
+		bool isDue = false;
+	};
+
+	/**
+	 * The sampling groups of the statistics currently in the statisticsMap. There can be at most one group per
+	 * statistic.
+	 */
+	etl::vector<SamplingGroup, ECSSMaxStatisticParameters> samplingGroups;
+
+	/**
+	 * The number of statistics that the sampling groups were built for, used to detect statistics that were added or
+	 * removed directly from the statisticsMap.
+	 */
+	size_t numberOfScheduledStatistics = 0;
+
+	/**
+	 * true means that the statistic definitions have changed since the sampling groups were built
+	 */
+	bool samplingGroupsAreOutdated = true;
+
+	/**
+	 * The time at which the next periodic TM[4,2] report is due, in milliseconds
+	 */
+	TimeStamps nextReportingTime = 0;
+
+	/**
+	 * true means that the reporting interval or status has changed, and nextReportingTime must be recalculated
+	 */
+	bool reportingTimeIsOutdated = true;
+
 	/**
 	 * Initializer of the statistics map, so that its content can be accessed by FreeRTOS tasks.
 	 */
 	void initializeStatisticsMap();
 
+	/**
+	 * Returns the interval at which a statistic is sampled. Statistics without a sampling interval of their own are
+	 * sampled at the reporting interval.
+	 */
+	SamplingInterval getEffectiveSamplingInterval(const Statistic& statistic) const;
+
+	/**
+	 * Returns the sampling group with the given interval, or nullptr if there is no such group.
+	 */
+	SamplingGroup* findSamplingGroup(SamplingInterval samplingInterval);
+
+	/**
+	 * Groups the statistics of the statisticsMap by their sampling interval. Groups that already existed keep their
+	 * next sampling time, while new groups are sampled at \p currentTime.
+	 */
+	void updateSamplingGroups(TimeStamps currentTime);
+
 public:
 	inline static const ServiceTypeNum ServiceType = 4;
 
@@ -69,6 +124,13 @@ public:
 	 */
 	const bool supportsSamplingInterval = true;
 
+	/**
+	 * Indicates whether to append/read the rolling window and histogram configuration of each definition to/from
+	 * TC[4,6] and TM[4,9], and the optional statistics of each parameter to TM[4,2]. This is a mission-specific
+	 * extension of the standard packet formats.
+	 */
+	bool supportsStatisticsAccumulators = false;
+
 	/**
 	 * Returns the periodic statistics reporting status
 	 */
@@ -81,6 +143,7 @@ public:
 	 */
 	inline void setPeriodicReportingStatus(bool status) {
 		periodicStatisticsReportingStatus = status;
+		reportingTimeIsOutdated = true;
 	}
 
 	/**
@@ -133,6 +196,10 @@ public:
 
 	/**
 	 * TC[4,6] add or update parameter statistics definitions
+	 *
+	 * If supportsStatisticsAccumulators is true, each definition is followed by the size of its rolling window as a
+	 * uint8 (0 disables the window), and the low and high limits of its histogram as floats (equal limits disable the
+	 * histogram).
 	 */
 	void addOrUpdateStatisticsDefinitions(Message& request);
 
@@ -150,6 +217,19 @@ public:
 	 */
 	void statisticsDefinitionsReport();
 
+	/**
+	 * Samples the parameters of every statistic whose sampling interval has elapsed, and generates a TM[4,2] report
+	 * if the periodic reporting is enabled and the reporting interval has elapsed. Statistics are grouped by their
+	 * sampling interval, so that each parameter is read once per pass.
+	 *
+	 * @note Statistics with a zero effective sampling interval are sampled on every call, but do not affect the
+	 * returned time.
+	 *
+	 * @param currentTime The current system time, in milliseconds.
+	 * @return The minimum amount of time until the next sample or periodic report is due, in milliseconds.
+	 */
+	TimeStamps samplePendingStatistics(TimeStamps currentTime);
+
 	/**
 	 * Calls the suitable function that executes a telecommand packet. The source of that packet
 	 * is the ground station.
@@ -6,6 +6,7 @@
 #include "Helpers/AllReportTypes.hpp"
 #include "Helpers/ForwardControlConfiguration.hpp"
 #include "Service.hpp"
+#include "etl/map.h"
 #include "etl/vector.h"
 
 /**
@@ -26,6 +27,13 @@ public:
 		DeleteReportTypesFromAppProcessConfiguration = 2,
 		ReportAppProcessConfigurationContent = 3,
 		AppProcessConfigurationContentReport = 4,
+		AddStructuresToHousekeepingConfiguration = 5,
+		DeleteStructuresFromHousekeepingConfiguration = 6,
+		ReportHousekeepingConfigurationContent = 7,
+		HousekeepingConfigurationContentReport = 8,
+		AddEventDefinitionsToEventReportConfiguration = 13,
+		DeleteEventDefinitionsFromEventReportConfiguration = 14,
+		ReportEventReportConfigurationContent = 15,
 		EventReportConfigurationContentReport = 16,
 	};
 
@@ -44,6 +52,18 @@ public:
 	 */
 	ApplicationProcessConfiguration applicationProcessConfiguration;
 
+	/**
+	 * The housekeeping parameter report configuration, containing the structure IDs of the housekeeping parameter
+	 * reports that are forwarded, for each application process.
+	 */
+	HousekeepingForwardControlConfiguration housekeepingConfiguration;
+
+	/**
+	 * The event report configuration, containing the event definition IDs of the event reports that are forwarded, for
+	 * each application process.
+	 */
+	EventReportForwardControlConfiguration eventReportConfiguration;
+
 	/**
 	 * Receives a TC[14,3] 'Report the application process forward control configuration content' message and
 	 * performs the necessary error checking.
@@ -54,7 +74,78 @@ public:
 	 * Creates and stores a TM[14,4] 'Application process forward control configuration content report' message.
 	 */
 	void appProcessConfigurationContentReport();
+
+	/**
+	 * The number of reports of a report type that were forwarded and dropped by @ref forwardReport
+	 */
+	struct ForwardingCounters {
+		uint32_t forwarded = 0;
+		uint32_t dropped = 0;
+	};
+
+	/**
+	 * The forwarding stage of the TM output path. Decides whether a generated report is forwarded to the ground station,
+	 * and counts the decision for the report type of the report.
+	 *
+	 * The reports of application processes that are not controlled by the Service are always forwarded. The reports of
+	 * the controlled application processes are only forwarded if their report type is in the application process
+	 * configuration. Housekeeping parameter reports and event reports must also have their structure ID or event
+	 * definition ID in the housekeeping parameter report or event report configuration.
+	 *
+	 * @note This is meant to be called by @ref Service::storeMessage for every TM, before its transmission.
+	 * @return True if the report is to be transmitted
+	 */
+	bool forwardReport(const Message& report);
+
+	/**
+	 * @return The reports of a report type that were forwarded and dropped so far
+	 */
+	ForwardingCounters getForwardingCounters(ServiceTypeNum serviceType, MessageTypeNum messageType) const;
+
+	/**
+	 * @return The reports that were forwarded and dropped so far, of the report types that did not fit in the
+	 * counters of their own, i.e. after the first @ref ECSSMaxForwardingCountedReportTypes report types
+	 */
+	const ForwardingCounters& getUncountedReportTypeCounters() const {
+		return uncountedReportTypeCounters;
+	}
+
+	/**
+	 * Decides whether a report, generated by an application process, is forwarded according to the application
+	 * process configuration. This is meant to be called for every generated TM, so it only consults the compiled
+	 * @ref forwardingFilter, unless the report type is not covered by it.
+	 */
+	bool isReportForwarded(ApplicationProcessId applicationID, ServiceTypeNum serviceType, MessageTypeNum messageType) {
+		if (ApplicationProcessForwardingFilter::covers(serviceType, messageType)) {
+			return forwardingFilter.isForwarded(applicationID, serviceType, messageType);
+		}
+		return isReportTypeEnabled(messageType, applicationID, serviceType);
+	}
+
 private:
+	/**
+	 * The forwarded and dropped reports of each report type that @ref forwardReport has seen
+	 */
+	etl::map<std::pair<ServiceTypeNum, MessageTypeNum>, ForwardingCounters, ECSSMaxForwardingCountedReportTypes> forwardingCounters;
+
+	/**
+	 * The forwarded and dropped reports of the report types that do not fit in @ref forwardingCounters
+	 */
+	ForwardingCounters uncountedReportTypeCounters;
+
+	/**
+	 * The application process configuration, compiled for the forwarding decisions. It is rebuilt after every TC[14,1]
+	 * and TC[14,2].
+	 */
+	ApplicationProcessForwardingFilter forwardingFilter;
+
+	/**
+	 * Compiles the application process configuration and the controlled applications into the @ref forwardingFilter.
+	 */
+	void rebuildForwardingFilter() {
+		forwardingFilter.rebuild(controlledApplications, applicationProcessConfiguration);
+	}
+
 	/**
 	 * Adds all report types of the specified application process definition, to the application process configuration.
 	 */
@@ -171,6 +262,26 @@ private:
 	 */
 	void deleteServiceRecursive(ApplicationProcessId applicationID, ServiceTypeNum serviceType);
 
+	/**
+	 * Adds the identifiers of a TC[14,5] or TC[14,13] to a housekeeping parameter report or event report configuration.
+	 */
+	template <class Configuration>
+	void addIdentifiersToConfiguration(Message& request, Configuration& configuration);
+
+	/**
+	 * Deletes the identifiers of a TC[14,6] or TC[14,14] from a housekeeping parameter report or event report
+	 * configuration.
+	 */
+	template <class Configuration>
+	void deleteIdentifiersFromConfiguration(Message& request, Configuration& configuration);
+
+	/**
+	 * Creates and stores a TM[14,8] or TM[14,16] report of a housekeeping parameter report or event report
+	 * configuration.
+	 */
+	template <class Configuration>
+	void identifierConfigurationContentReport(MessageType messageType, const Configuration& configuration);
+
 	/**
 	 * Deletes the requested report type from the application process configuration. If the deletion results in an
 	 * empty service, it deletes the corresponding service. If the deletion of the service, results in an empty
@@ -189,6 +300,58 @@ public:
 	 */
 	void deleteReportTypesFromAppProcessConfiguration(Message& request);
 
+	/**
+	 * TC[14,5] 'Add structure identifiers to the housekeeping parameter report forward control configuration'.
+	 *
+	 * An application process without any structure IDs enables all of its housekeeping parameter reports.
+	 */
+	void addStructuresToHousekeepingConfiguration(Message& request);
+
+	/**
+	 * TC[14,6] 'Delete structure identifiers from the housekeeping parameter report forward control configuration'.
+	 *
+	 * An empty request empties the configuration, and an application process without any structure IDs is deleted
+	 * from it.
+	 */
+	void deleteStructuresFromHousekeepingConfiguration(Message& request);
+
+	/**
+	 * TC[14,7] 'Report the housekeeping parameter report forward control configuration content'.
+	 */
+	void reportHousekeepingConfigurationContent(Message& request);
+
+	/**
+	 * Creates and stores a TM[14,8] 'Housekeeping parameter report forward control configuration content report'
+	 * message. An application process with all of its structure IDs enabled is reported without any structure IDs.
+	 */
+	void housekeepingConfigurationContentReport();
+
+	/**
+	 * TC[14,13] 'Add event definitions to the event report forward control configuration'.
+	 *
+	 * An application process without any event definition IDs enables all of its event reports.
+	 */
+	void addEventDefinitionsToEventReportConfiguration(Message& request);
+
+	/**
+	 * TC[14,14] 'Delete event definitions from the event report forward control configuration'.
+	 *
+	 * An empty request empties the configuration, and an application process without any event definition IDs is
+	 * deleted from it.
+	 */
+	void deleteEventDefinitionsFromEventReportConfiguration(Message& request);
+
+	/**
+	 * TC[14,15] 'Report the event report forward control configuration content'.
+	 */
+	void reportEventReportConfigurationContent(Message& request);
+
+	/**
+	 * Creates and stores a TM[14,16] 'Event report forward control configuration content report' message. An
+	 * application process with all of its event definition IDs enabled is reported without any event definition IDs.
+	 */
+	void eventReportConfigurationContentReport();
+
 	/**
 	 * It is responsible to call the suitable function that executes a TC packet. The source of that packet
 	 * is the ground station.
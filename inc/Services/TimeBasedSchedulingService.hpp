@@ -2,10 +2,12 @@
 #define ECSS_SERVICES_TIMEBASEDSCHEDULINGSERVICE_HPP
 
 #include "ErrorHandler.hpp"
+#include "Helpers/BlobArena.hpp"
 #include "Helpers/CRCHelper.hpp"
+#include "Helpers/ScheduledActivityHeap.hpp"
+#include "Helpers/SlotGroups.hpp"
 #include "MessageParser.hpp"
 #include "Service.hpp"
-#include "etl/list.h"
 
 // Include platform specific files
 #include "Helpers/TimeGetter.hpp"
@@ -14,16 +16,28 @@
 /**
  * @def GROUPS_ENABLED
  * @brief Indicates whether scheduling groups are enabled
+ *
+ * @details If enabled, each activity of TC[11,4] and of the TM[11,10] and TM[11,13] reports
+ * carries its group ID. Otherwise all activities belong to group 0. This changes the format of
+ * these packets, so it is disabled by default, and can be enabled for the whole build with the
+ * ECSS_TIME_SCHED_GROUPS CMake option.
  */
+#ifndef GROUPS_ENABLED
 #define GROUPS_ENABLED 0 // NOLINT(cppcoreguidelines-macro-usage)
+#endif
 
 /**
  * @def SUB_SCHEDULES_ENABLED
  * @brief Indicates whether sub-schedules are supported
  *
- * @details Sub-schedules are currently not implemented so this has no effect
+ * @details If enabled, TC[11,4] starts with the sub-schedule ID of its activities, and each
+ * activity of the TM[11,10] and TM[11,13] reports carries its sub-schedule ID. Otherwise all
+ * activities belong to sub-schedule 0. Like @ref GROUPS_ENABLED, this is disabled by default,
+ * and is enabled by the ECSS_TIME_SCHED_GROUPS CMake option.
  */
+#ifndef SUB_SCHEDULES_ENABLED
 #define SUB_SCHEDULES_ENABLED 0 // NOLINT(cppcoreguidelines-macro-usage)
+#endif
 
 /**
  * @brief Namespace to access private members during test
@@ -69,44 +83,134 @@ private:
 			return (sequenceCount != rightSide.sequenceCount) or (applicationID != rightSide.applicationID) or
 			       (sourceID != rightSide.sourceID);
 		}
+
+		bool operator<(const RequestID& rightSide) const {
+			if (applicationID != rightSide.applicationID) {
+				return applicationID < rightSide.applicationID;
+			}
+			if (sequenceCount != rightSide.sequenceCount) {
+				return sequenceCount < rightSide.sequenceCount;
+			}
+			return sourceID < rightSide.sourceID;
+		}
 	};
 
 	/**
 	 * @brief Instances of activities to run in the schedule
 	 *
-	 * @details All scheduled activities must contain the request they exist for, their release
-	 * time and the corresponding request identifier.
-	 *
-	 * @todo If we decide to use sub-schedules, the ID of that has to be defined
-	 * @todo If groups are used, then the group ID has to be defined here
+	 * @details All scheduled activities must contain their release time and the corresponding
+	 * request identifier. The request they exist for is kept in @ref scheduledRequests.
 	 */
 	struct ScheduledActivity {
-		Message request;                         ///< Hold the received command request
 		RequestID requestID;                     ///< Request ID, characteristic of the definition
 		Time::DefaultCUC requestReleaseTime{0}; ///< Keep the command release time
+		SubScheduleId subScheduleID = 0;         ///< The sub-schedule that contains the activity
+		ScheduleGroupId groupID = 0;             ///< The group that contains the activity
 	};
 
 	/**
 	 * @brief Hold the scheduled activities
 	 *
-	 * @details The scheduled activities in this list are ordered by their release time, as the
-	 * standard requests.
+	 * @details The scheduled activities are kept ordered by their release time, as the standard
+	 * requests, and indexed by their request identifier. The activities of a disabled sub-schedule
+	 * or group are parked, so that they are skipped by the release of activities.
 	 */
-	etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> scheduledActivities;
+	ScheduledActivityHeap<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> scheduledActivities;
 
 	/**
-	 * @brief Sort the activities by their release time
+	 * @brief Hold the requests of the scheduled activities
 	 *
-	 * @details The ECSS standard requires that the activities are sorted in the TM message
-	 * response. Also it is better to have the activities sorted.
-	 */
-	inline static void
-	sortActivitiesReleaseTime(etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& schedActivities) {
-		schedActivities.sort([](ScheduledActivity const& leftSide, ScheduledActivity const& rightSide) {
-			// cppcheck-suppress
-			return leftSide.requestReleaseTime < rightSide.requestReleaseTime;
-		});
-	}
+	 * @details Each request is stored as the bytes of the received TC string without its trailing
+	 * zeros, under the slot of its activity in @ref scheduledActivities. A Message is only created
+	 * for a request when it is released or reported.
+	 */
+	BlobArena<ECSSTimeSchedRequestArenaSize, ECSSMaxNumberOfTimeSchedActivities> scheduledRequests;
+
+	/**
+	 * @brief A scheduled activity, identified by its slot in @ref scheduledActivities
+	 */
+	using ScheduledActivitySlot = ScheduledActivityHeap<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>::Slot;
+
+	/**
+	 * @brief A list of scheduled activities, identified by their slot in @ref scheduledActivities
+	 */
+	using ScheduledActivitySlots = ScheduledActivityHeap<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>::SlotList;
+
+	/**
+	 * @brief The scheduled activities of each sub-schedule
+	 */
+	SlotGroups<ECSSMaxNumberOfTimeSchedActivities, ECSSMaxNumberOfTimeSchedSubSchedules> subScheduleActivities;
+
+	/**
+	 * @brief The scheduled activities of each group
+	 */
+	SlotGroups<ECSSMaxNumberOfTimeSchedActivities, ECSSMaxNumberOfTimeSchedGroups> groupActivities;
+
+	/**
+	 * @brief Whether each sub-schedule is enabled
+	 */
+	etl::array<bool, ECSSMaxNumberOfTimeSchedSubSchedules> subScheduleStatus;
+
+	/**
+	 * @brief Whether each group is enabled
+	 */
+	etl::array<bool, ECSSMaxNumberOfTimeSchedGroups> groupStatus;
+
+	/**
+	 * @brief The size of the sub-schedule and group IDs of an activity in the TM[11,10] and TM[11,13]
+	 * reports
+	 */
+	inline static constexpr uint16_t ReportedIdsSize = (SUB_SCHEDULES_ENABLED ? sizeof(SubScheduleId) : 0) +
+	                                                   (GROUPS_ENABLED ? sizeof(ScheduleGroupId) : 0);
+
+	/**
+	 * @brief The number of activities that fit in a single TM[11,10] report, after the activity count
+	 */
+	inline static constexpr uint16_t MaxActivitiesPerDetailReport =
+	    (ECSSMaxMessageSize - sizeof(uint16_t)) / (ReportedIdsSize + sizeof(uint32_t) + ECSSTCRequestStringSize);
+
+	/**
+	 * @brief The number of activities that fit in a single TM[11,13] report, after the activity count
+	 */
+	inline static constexpr uint16_t MaxActivitiesPerSummaryReport =
+	    (ECSSMaxMessageSize - sizeof(uint16_t)) /
+	    (ReportedIdsSize + sizeof(uint32_t) + sizeof(SourceId) + sizeof(ApplicationProcessId) + sizeof(SequenceCount));
+
+	/**
+	 * @brief Read a request identifier from a TC
+	 */
+	static RequestID readRequestID(Message& request);
+
+	/**
+	 * @brief Create the TC of a scheduled activity from its stored request
+	 */
+	Message scheduledRequest(ScheduledActivitySlot slot) const;
+
+	/**
+	 * @brief Read the time window and the sub-schedules and groups of a TC[11,11] or TC[11,14]
+	 * filter, and find the activities that it selects
+	 *
+	 * @param matchedActivities The selected activities, ordered by their release time
+	 * @return False if the filter is not valid, in which case an error has been reported
+	 */
+	bool readActivityFilter(Message& request, ScheduledActivitySlots& matchedActivities);
+
+	/**
+	 * @brief Remove the request of a scheduled activity, and the activity from its sub-schedule and
+	 * group
+	 */
+	void detachActivity(ScheduledActivitySlot slot);
+
+	/**
+	 * @brief Remove a scheduled activity and its request
+	 */
+	void removeActivity(ScheduledActivitySlot slot);
+
+	/**
+	 * @brief Park or unpark a scheduled activity, depending on whether its sub-schedule and group
+	 * are both enabled
+	 */
+	void updateReleaseStatus(ScheduledActivitySlot slot);
 
 	/**
 	 * @brief Define a friend in order to be able to access private members during testing
@@ -134,10 +238,26 @@ public:
 		TimeShiftActivitiesById = 7,
 		DetailReportActivitiesById = 9,
 		TimeBasedScheduleReportById = 10,
+		DetailReportActivitiesByFilter = 11,
 		ActivitiesSummaryReportById = 12,
 		TimeBasedScheduledSummaryReport = 13,
+		ActivitiesSummaryReportByFilter = 14,
 		TimeShiftALlScheduledActivities = 15,
 		DetailReportAllScheduledActivities = 16,
+		EnableTimeBasedSubSchedules = 20,
+		DisableTimeBasedSubSchedules = 21,
+		EnableTimeBasedScheduleGroups = 24,
+		DisableTimeBasedScheduleGroups = 25,
+	};
+
+	/**
+	 * @brief The time windows that a TC[11,11] or TC[11,14] filter can select
+	 */
+	enum TimeWindowType : uint8_t {
+		SelectAll = 0,
+		FromTagToTag = 1,
+		FromTag = 2,
+		ToTag = 3,
 	};
 
 	/**
@@ -152,6 +272,18 @@ public:
 	 */
 	Time::DefaultCUC executeScheduledActivity(Time::DefaultCUC currentTime);
 
+	/**
+	 * This function executes all the activities that are due at the current time, in the order of their release
+	 * time, and removes them from the schedule.
+	 *
+	 * @param currentTime The current time
+	 * @param releaseBudget The maximum number of activities to execute in this call
+	 * @return The requestReleaseTime of the next activity to be executed, or Time::DefaultCUC::max() if the schedule
+	 * is empty. If the budget ran out before all the due activities were executed, this is not later than
+	 * currentTime, and the function should be called again without waiting.
+	 */
+	Time::DefaultCUC executeScheduledActivities(Time::DefaultCUC currentTime, uint16_t releaseBudget = ECSSTimeSchedReleaseBudget);
+
 	/**
 	 * @brief TC[11,1] enable the time-based schedule execution function
 	 *
@@ -177,6 +309,95 @@ public:
 	 */
 	void resetSchedule(Message& request);
 
+	/**
+	 * @brief Enable or disable the release of the activities of a sub-schedule
+	 *
+	 * @details The activities of a disabled sub-schedule stay in the schedule, but are not released
+	 * until the sub-schedule is enabled again. Costs O(k log n) for a sub-schedule of k activities.
+	 * @param subScheduleID The sub-schedule, which must be lower than
+	 * @ref ECSSMaxNumberOfTimeSchedSubSchedules
+	 */
+	void setSubScheduleStatus(SubScheduleId subScheduleID, bool enabled);
+
+	/**
+	 * @brief Enable or disable the release of the activities of a group
+	 *
+	 * @details The activities of a disabled group stay in the schedule, but are not released until
+	 * the group is enabled again. Costs O(k log n) for a group of k activities.
+	 * @param groupID The group, which must be lower than @ref ECSSMaxNumberOfTimeSchedGroups
+	 */
+	void setGroupStatus(ScheduleGroupId groupID, bool enabled);
+
+	bool isSubScheduleEnabled(SubScheduleId subScheduleID) const {
+		return subScheduleStatus[subScheduleID];
+	}
+
+	bool isGroupEnabled(ScheduleGroupId groupID) const {
+		return groupStatus[groupID];
+	}
+
+	/**
+	 * @return The number of scheduled activities in a group
+	 */
+	size_t getGroupActivityCount(ScheduleGroupId groupID) const {
+		return groupActivities.size(groupID);
+	}
+
+	/**
+	 * @brief Time-shift all the activities of a group
+	 *
+	 * @details Costs O(k log n) for a group of k activities.
+	 * @param groupID The group, which must be lower than @ref ECSSMaxNumberOfTimeSchedGroups
+	 * @param relativeOffset The time offset, in seconds
+	 * @return False if an activity of the group would be released earlier than the time margin
+	 * defined in @ref ECSSTimeMarginForActivation, in which case no activity is shifted
+	 */
+	bool timeShiftGroup(ScheduleGroupId groupID, Time::RelativeTime relativeOffset);
+
+	/**
+	 * @brief Delete all the activities of a group
+	 *
+	 * @details Costs O(k log n) for a group of k activities.
+	 * @param groupID The group, which must be lower than @ref ECSSMaxNumberOfTimeSchedGroups
+	 */
+	void deleteGroupActivities(ScheduleGroupId groupID);
+
+	/**
+	 * @brief TC[11,20] enable time-based sub-schedules
+	 *
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a sub-schedule ID does not exist, an @ref
+	 * ErrorHandler::ExecutionStartErrorType is issued for that instruction.
+	 */
+	void enableSubSchedules(Message& request);
+
+	/**
+	 * @brief TC[11,21] disable time-based sub-schedules
+	 *
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a sub-schedule ID does not exist, an @ref
+	 * ErrorHandler::ExecutionStartErrorType is issued for that instruction.
+	 */
+	void disableSubSchedules(Message& request);
+
+	/**
+	 * @brief TC[11,24] enable time-based scheduling groups
+	 *
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a group ID does not exist, an @ref
+	 * ErrorHandler::ExecutionStartErrorType is issued for that instruction.
+	 */
+	void enableGroups(Message& request);
+
+	/**
+	 * @brief TC[11,25] disable time-based scheduling groups
+	 *
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a group ID does not exist, an @ref
+	 * ErrorHandler::ExecutionStartErrorType is issued for that instruction.
+	 */
+	void disableGroups(Message& request);
+
 	/**
 	 * @brief TC[11,4] insert activities into the time based schedule
 	 *
@@ -198,7 +419,8 @@ public:
 	 * @brief TC[11,15] time-shift all scheduled activities
 	 *
 	 * @details All scheduled activities are shifted per user request. The relative time offset
-	 * received and tested against the current time.
+	 * received and tested against the current time, for the earliest activity including the ones
+	 * of disabled sub-schedules and groups.
 	 * @param request Provide the received message as a parameter
 	 * @todo Definition of the time format is required for the relative time format
 	 * @throws ExecutionStartError If the release time of the request is less than a
@@ -217,14 +439,41 @@ public:
 	 */
 	void detailReportAllActivities(Message& request);
 
+	/**
+	 * @brief TC[11,11] detail-report the activities selected by a filter
+	 *
+	 * @details The filter consists of a @ref TimeWindowType, followed by its time tags, and of the
+	 * lists of sub-schedules and groups, if they are enabled, where an empty list selects all of
+	 * them. Generates a TM[11,10] response, with the activities ordered by their release time.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If the time window is not valid, or if a sub-schedule or group
+	 * ID does not exist.
+	 */
+	void detailReportActivitiesByFilter(Message& request);
+
+	/**
+	 * @brief TC[11,14] summary-report the activities selected by a filter
+	 *
+	 * @details The filter is the same as the one of TC[11,11]. Generates a TM[11,13] response, with
+	 * the activities ordered by their release time.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If the time window is not valid, or if a sub-schedule or group
+	 * ID does not exist.
+	 */
+	void summaryReportActivitiesByFilter(Message& request);
+
 	/**
 	 * @brief TM[11,10] time-based schedule detail report
 	 *
 	 * @details Send a detailed report about the status of the activities listed
-	 * on the provided list. Generates a TM[11,10] response.
+	 * on the provided list. Generates a TM[11,10] response, split into as many reports as needed
+	 * so that none of them is larger than @ref ECSSMaxMessageSize.
 	 * @param listOfActivities Provide the list of activities that need to be reported on
+	 * @param activitiesPerReport The maximum number of activities in each report, from 1 to
+	 * @ref MaxActivitiesPerDetailReport
 	 */
-	void timeBasedScheduleDetailReport(const etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& listOfActivities);
+	void timeBasedScheduleDetailReport(const ScheduledActivitySlots& listOfActivities,
+	                                   uint16_t activitiesPerReport = MaxActivitiesPerDetailReport);
 
 	/**
 	 * @brief TC[11,9] detail-report activities identified by request identifier
@@ -257,10 +506,14 @@ public:
 	 * @brief TM[11,13] time-based schedule summary report
 	 *
 	 * @details Send a summary report about the status of the activities listed
-	 * on the provided list. Generates a TM[11,13] response.
+	 * on the provided list. Generates a TM[11,13] response, split into as many reports as needed
+	 * so that none of them is larger than @ref ECSSMaxMessageSize.
 	 * @param listOfActivities Provide the list of activities that need to be reported on
+	 * @param activitiesPerReport The maximum number of activities in each report, from 1 to
+	 * @ref MaxActivitiesPerSummaryReport
 	 */
-	void timeBasedScheduleSummaryReport(const etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& listOfActivities);
+	void timeBasedScheduleSummaryReport(const ScheduledActivitySlots& listOfActivities,
+	                                    uint16_t activitiesPerReport = MaxActivitiesPerSummaryReport);
 
 	/**
 	 * @brief TC[11,5] delete time-based scheduled activities identified by a request identifier
@@ -10,4 +10,35 @@ namespace FilepathValidators {
 
 		return wildcardPosition;
 	}
+
+	bool matchesWildcardPattern(etl::string_view pattern, etl::string_view path) {
+		constexpr size_t NoWildcard = etl::string_view::npos;
+
+		size_t patternPosition = 0;
+		size_t pathPosition = 0;
+		// The last wildcard seen, and the position in the path where its match ends so far
+		size_t wildcardPosition = NoWildcard;
+		size_t wildcardMatchEnd = 0;
+
+		while (pathPosition < path.size()) {
+			if (patternPosition < pattern.size() and pattern[patternPosition] == FileManagementService::Wildcard) {
+				wildcardPosition = patternPosition++;
+				wildcardMatchEnd = pathPosition;
+			} else if (patternPosition < pattern.size() and pattern[patternPosition] == path[pathPosition]) {
+				patternPosition++;
+				pathPosition++;
+			} else if (wildcardPosition != NoWildcard) {
+				// Let the last wildcard match one more character, and retry the rest of the pattern
+				patternPosition = wildcardPosition + 1;
+				pathPosition = ++wildcardMatchEnd;
+			} else {
+				return false;
+			}
+		}
+
+		while (patternPosition < pattern.size() and pattern[patternPosition] == FileManagementService::Wildcard) {
+			patternPosition++;
+		}
+		return patternPosition == pattern.size();
+	}
 } // namespace FilepathValidators
\ No newline at end of file
@@ -2,6 +2,76 @@
 #include "ServicePool.hpp"
 
 
-PMONBase::PMONBase(PMONId monitoredParameterId, uint16_t repetitionNumber)
+PMONBase::PMONBase(PMONId monitoredParameterId, uint16_t repetitionNumber, CheckType checkType)
     : monitoredParameter(Services.parameterManagement.getParameter(monitoredParameterId)->get()), monitoredParameterId(monitoredParameterId),
-      repetitionNumber(repetitionNumber) {}
\ No newline at end of file
+      repetitionNumber(repetitionNumber), checkType(checkType) {}
+
+bool PMONBase::updateCheckingStatus(CheckingStatus checkResult) {
+	if (checkResult == Unchecked) {
+		return false;
+	}
+
+	if (checkResult == checkingStatus) {
+		pendingCheckingStatus = Unchecked;
+		repetitionCounter = 0;
+		return false;
+	}
+
+	if (checkResult != pendingCheckingStatus) {
+		pendingCheckingStatus = checkResult;
+		repetitionCounter = 0;
+	}
+	repetitionCounter++;
+
+	if (repetitionCounter < repetitionNumber) {
+		return false;
+	}
+
+	checkTransitionList = {checkingStatus, checkResult};
+	checkingStatus = checkResult;
+	pendingCheckingStatus = Unchecked;
+	repetitionCounter = 0;
+	return true;
+}
+
+void PMONBase::resetCheckingStatus() {
+	checkingStatus = Unchecked;
+	pendingCheckingStatus = Unchecked;
+	repetitionCounter = 0;
+}
+
+PMONBase::CheckingStatus PMONExpectedValueCheck::checkValue(double value) const {
+	const uint64_t maskedValue = static_cast<uint64_t>(value) & mask;
+	if (maskedValue == static_cast<uint64_t>(expectedValue)) {
+		return ExpectedValue;
+	}
+	return UnexpectedValue;
+}
+
+PMONBase::CheckingStatus PMONDeltaCheck::checkValue(double value) {
+	if (not previousValueIsValid) {
+		previousValue = value;
+		previousValueIsValid = true;
+		return Unchecked;
+	}
+
+	deltaSum += value - previousValue;
+	deltaCount++;
+	previousValue = value;
+
+	if (deltaCount < numberOfConsecutiveDeltaChecks) {
+		return Unchecked;
+	}
+
+	const double averageDelta = deltaSum / deltaCount;
+	deltaSum = 0;
+	deltaCount = 0;
+
+	if (averageDelta < lowDeltaThreshold) {
+		return BelowLowThreshold;
+	}
+	if (averageDelta > highDeltaThreshold) {
+		return AboveHighThreshold;
+	}
+	return WithinThreshold;
+}
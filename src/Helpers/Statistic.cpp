@@ -1,5 +1,7 @@
 #include "Helpers/Statistic.hpp"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 void Statistic::updateStatistics(double value) {
 	if (value > max) {
@@ -10,11 +12,99 @@ void Statistic::updateStatistics(double value) {
 		min = value;
 		timeOfMinValue = TimeGetter::getCurrentTimeDefaultCUC();
 	}
-	if (sampleCounter + 1 > 0) {
-		mean = (mean * sampleCounter + value) / (sampleCounter + 1);
+	updateAccumulators(value);
+}
+
+void Statistic::updateStatistics(double value, const Time::DefaultCUC& sampleTime) {
+	if (value > max) {
+		max = value;
+		timeOfMaxValue = sampleTime;
+	}
+	if (value < min) {
+		min = value;
+		timeOfMinValue = sampleTime;
 	}
-	sumOfSquares += pow(value, 2);
+	updateAccumulators(value);
+}
+
+void Statistic::updateAccumulators(double value) {
+	mean = (mean * sampleCounter + value) / (sampleCounter + 1);
+	sumOfSquares += value * value;
 	sampleCounter++;
+	window.update(value);
+	histogram.update(value);
+}
+
+void Statistic::updateStatistics(etl::span<const double> values, const Time::DefaultCUC& sampleTime) {
+	if (values.empty()) {
+		return;
+	}
+
+	// Independent accumulators remove the dependency between consecutive iterations, which would otherwise prevent
+	// the vectorization of the floating point reductions.
+	constexpr size_t Lanes = 4;
+
+	double blockMax[Lanes];
+	double blockMin[Lanes];
+	double blockSum[Lanes] = {};
+	double blockSumOfSquares[Lanes] = {};
+	for (size_t lane = 0; lane < Lanes; lane++) {
+		blockMax[lane] = -std::numeric_limits<double>::infinity();
+		blockMin[lane] = std::numeric_limits<double>::infinity();
+	}
+
+	const double* data = values.data();
+	const size_t count = values.size();
+	const size_t vectorizedCount = count - count % Lanes;
+
+	for (size_t i = 0; i < vectorizedCount; i += Lanes) {
+		for (size_t lane = 0; lane < Lanes; lane++) {
+			const double value = data[i + lane];
+			blockMax[lane] = (value > blockMax[lane]) ? value : blockMax[lane];
+			blockMin[lane] = (value < blockMin[lane]) ? value : blockMin[lane];
+			blockSum[lane] += value;
+			blockSumOfSquares[lane] += value * value;
+		}
+	}
+	for (size_t i = vectorizedCount; i < count; i++) {
+		const double value = data[i];
+		blockMax[0] = (value > blockMax[0]) ? value : blockMax[0];
+		blockMin[0] = (value < blockMin[0]) ? value : blockMin[0];
+		blockSum[0] += value;
+		blockSumOfSquares[0] += value * value;
+	}
+
+	for (size_t lane = 1; lane < Lanes; lane++) {
+		blockMax[0] = std::max(blockMax[0], blockMax[lane]);
+		blockMin[0] = std::min(blockMin[0], blockMin[lane]);
+		blockSum[0] += blockSum[lane];
+		blockSumOfSquares[0] += blockSumOfSquares[lane];
+	}
+
+	if (blockMax[0] > max) {
+		max = blockMax[0];
+		timeOfMaxValue = sampleTime;
+	}
+	if (blockMin[0] < min) {
+		min = blockMin[0];
+		timeOfMinValue = sampleTime;
+	}
+	mean = (mean * sampleCounter + blockSum[0]) / (sampleCounter + count);
+	sumOfSquares += blockSumOfSquares[0];
+	sampleCounter += count;
+
+	if (window.isEnabled()) {
+		// Only the samples that remain in the window need to be stored
+		const size_t firstSampleInWindow = (count > window.getSize()) ? count - window.getSize() : 0;
+		for (size_t i = firstSampleInWindow; i < count; i++) {
+			window.update(data[i]);
+		}
+	}
+	if (histogram.isEnabled()) {
+		for (size_t i = 0; i < count; i++) {
+			histogram.update(data[i]);
+		}
+	}
 }
 
 void Statistic::appendStatisticsToMessage(Message& report) const {
@@ -36,6 +126,29 @@ void Statistic::appendStatisticsToMessage(Message& report) const {
 	}
 }
 
+void Statistic::appendAccumulatorsToMessage(Message& report) const {
+	uint8_t flags = 0;
+	if (window.isEnabled()) {
+		flags |= WindowEnabled;
+	}
+	if (histogram.isEnabled()) {
+		flags |= HistogramEnabled;
+	}
+	report.appendUint8(flags);
+
+	if (window.isEnabled()) {
+		report.appendUint8(window.getSampleCount());
+		report.appendFloat(static_cast<float>(window.getMax()));
+		report.appendFloat(static_cast<float>(window.getMin()));
+		report.appendFloat(static_cast<float>(window.getMean()));
+	}
+	if (histogram.isEnabled()) {
+		report.appendFloat(static_cast<float>(histogram.getPercentile(50)));
+		report.appendFloat(static_cast<float>(histogram.getPercentile(95)));
+		report.appendFloat(static_cast<float>(histogram.getPercentile(99)));
+	}
+}
+
 void Statistic::setSelfSamplingInterval(SamplingInterval samplingInterval) {
 	this->selfSamplingInterval = samplingInterval;
 }
@@ -48,6 +161,8 @@ void Statistic::resetStatistics() {
 	mean = 0;
 	sumOfSquares = 0;
 	sampleCounter = 0;
+	window.reset();
+	histogram.reset();
 }
 
 bool Statistic::statisticsAreInitialized() const {
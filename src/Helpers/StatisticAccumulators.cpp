@@ -0,0 +1,112 @@
+#include "Helpers/StatisticAccumulators.hpp"
+#include <algorithm>
+#include <limits>
+
+void StatisticWindow::setSize(uint8_t size) {
+	windowSize = std::min(size, ECSSMaxStatisticWindowSize);
+	reset();
+}
+
+void StatisticWindow::update(double value) {
+	if (windowSize == 0) {
+		return;
+	}
+
+	samples[nextIndex] = value;
+	nextIndex++;
+	if (nextIndex >= windowSize) {
+		nextIndex = 0;
+	}
+	if (sampleCount < windowSize) {
+		sampleCount++;
+	}
+}
+
+void StatisticWindow::reset() {
+	sampleCount = 0;
+	nextIndex = 0;
+}
+
+double StatisticWindow::getMax() const {
+	if (sampleCount == 0) {
+		return 0;
+	}
+	return *std::max_element(samples.begin(), samples.begin() + sampleCount);
+}
+
+double StatisticWindow::getMin() const {
+	if (sampleCount == 0) {
+		return 0;
+	}
+	return *std::min_element(samples.begin(), samples.begin() + sampleCount);
+}
+
+double StatisticWindow::getMean() const {
+	if (sampleCount == 0) {
+		return 0;
+	}
+	double sum = 0;
+	for (uint8_t i = 0; i < sampleCount; i++) {
+		sum += samples[i];
+	}
+	return sum / sampleCount;
+}
+
+void StatisticHistogram::setRange(double low, double high) {
+	lowLimit = low;
+	highLimit = high;
+	reset();
+}
+
+void StatisticHistogram::update(double value) {
+	if (not isEnabled()) {
+		return;
+	}
+
+	double position = (value - lowLimit) / (highLimit - lowLimit) * ECSSStatisticHistogramBins;
+	uint8_t bin = 0;
+	if (position >= ECSSStatisticHistogramBins) {
+		bin = ECSSStatisticHistogramBins - 1;
+	} else if (position > 0) {
+		bin = static_cast<uint8_t>(position);
+	}
+
+	if (bins[bin] == std::numeric_limits<uint16_t>::max()) {
+		// Rounding up keeps every bin that had samples non-empty
+		sampleCount = 0;
+		for (auto& count: bins) {
+			count = (count + 1) / 2;
+			sampleCount += count;
+		}
+	}
+	bins[bin]++;
+	sampleCount++;
+}
+
+void StatisticHistogram::reset() {
+	bins.fill(0);
+	sampleCount = 0;
+}
+
+double StatisticHistogram::getPercentile(double percentile) const {
+	if (sampleCount == 0) {
+		return 0;
+	}
+
+	const double binWidth = (highLimit - lowLimit) / ECSSStatisticHistogramBins;
+	const double rank = std::clamp(percentile, 0.0, 100.0) / 100.0 * sampleCount;
+
+	uint32_t samplesBelow = 0;
+	for (uint8_t bin = 0; bin < ECSSStatisticHistogramBins; bin++) {
+		if (bins[bin] == 0) {
+			continue;
+		}
+		if (samplesBelow + bins[bin] >= rank) {
+			double fractionOfBin = (rank - samplesBelow) / bins[bin];
+			return lowLimit + (bin + fractionOfBin) * binWidth;
+		}
+		samplesBelow += bins[bin];
+	}
+
+	return highLimit;
+}
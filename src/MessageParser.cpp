@@ -47,6 +47,12 @@ void MessageParser::execute(Message& message) {
 			break;
 #endif
 
+#ifdef SERVICE_LARGEPACKET
+		case LargePacketTransferService::ServiceType:
+			Services.largePacketTransferService.execute(message);
+			break;
+#endif
+
 #ifdef SERVICE_STORAGEANDRETRIEVAL
 		case StorageAndRetrievalService::ServiceType:
 			Services.storageAndRetrieval.execute(message);
@@ -148,7 +154,7 @@ void MessageParser::parseECSSTCHeader(const uint8_t* data, uint16_t length, Mess
 }
 
 Message MessageParser::parseECSSTC(String<ECSSTCRequestStringSize> data) {
-	Message message;
+	Message message{};
 	auto* dataInt = reinterpret_cast<uint8_t*>(data.data());
 	message.packetType = Message::TC;
 	parseECSSTCHeader(dataInt, ECSSTCRequestStringSize, message);
@@ -156,7 +162,7 @@ Message MessageParser::parseECSSTC(String<ECSSTCRequestStringSize> data) {
 }
 
 Message MessageParser::parseECSSTC(uint8_t* data) {
-	Message message;
+	Message message{};
 	message.packetType = Message::TC;
 	parseECSSTCHeader(data, ECSSTCRequestStringSize, message);
 	return message;
@@ -1,42 +1,386 @@
-#include "Helpers/Filesystem.hpp"
+#include "Platform/x86/Helpers/FilesystemRoot.hpp"
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/xattr.h>
+#include <unistd.h>
 
 /**
- * These functions are built on the x86_services target and will never run.
- * To combat undefined function errors, they are defined here.
- * Each function returns the minimum viable option without errors.
+ * POSIX implementation of the filesystem functions, for the x86 platform.
+ *
+ * Paths are resolved under a configurable root directory into fixed-size buffers, so no operation allocates memory.
+ * The lock status of a file is kept in a user extended attribute of the file, so that locking a file neither changes
+ * its permissions nor adds new entries to its directory. On host filesystems without user extended attributes, a file
+ * is locked by removing the write permission of its owner instead.
  */
 namespace Filesystem {
+	namespace {
+		/**
+		 * A path on the host, i.e. the root directory, a '/' delimiter and a filesystem path
+		 */
+		using HostPath = String<RootDirectorySize + 1 + FullPathSize>;
+
+		/**
+		 * The extended attribute that marks a file as locked
+		 */
+		constexpr const char* LockAttribute = "user.ecss.locked";
+
+		RootDirectory root = "";
+
+		/**
+		 * @return Whether the path has a ".." component, which could lead outside the root directory
+		 */
+		bool leavesRootDirectory(const Path& path) {
+			size_t componentStart = 0;
+			while (componentStart <= path.size()) {
+				size_t componentEnd = path.find('/', componentStart);
+				if (componentEnd == Path::npos) {
+					componentEnd = path.size();
+				}
+				if (componentEnd - componentStart == 2 and path[componentStart] == '.' and path[componentStart + 1] == '.') {
+					return true;
+				}
+				componentStart = componentEnd + 1;
+			}
+			return false;
+		}
+
+		/**
+		 * Resolves a filesystem path to a path on the host. Without a root directory, absolute paths are rejected, as
+		 * nothing would confine them.
+		 * @return The host path, or nothing if the path leaves the root directory
+		 */
+		etl::optional<HostPath> toHostPath(const Path& path) {
+			if (leavesRootDirectory(path) or (root.empty() and not path.empty() and path[0] == '/')) {
+				return etl::nullopt;
+			}
+
+			HostPath hostPath = "";
+			if (not root.empty()) {
+				hostPath.append(root);
+				hostPath.append("/");
+			}
+			hostPath.append(path);
+			return hostPath;
+		}
+
+		bool isLocked(const HostPath& hostPath) {
+			uint8_t locked = 0;
+			if (getxattr(hostPath.c_str(), LockAttribute, &locked, sizeof(locked)) == static_cast<ssize_t>(sizeof(locked)) and locked != 0) {
+				return true;
+			}
+
+			struct stat status {};
+			return stat(hostPath.c_str(), &status) == 0 and S_ISREG(status.st_mode) and (status.st_mode & S_IWUSR) == 0;
+		}
+	} // namespace
+
+	void setRootDirectory(const RootDirectory& rootDirectory) {
+		root = rootDirectory;
+	}
+
+	const RootDirectory& getRootDirectory() {
+		return root;
+	}
+
 	etl::optional<FileCreationError> createFile(const Path& path) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return FileCreationError::UnknownError;
+		}
+
+		int file = open(hostPath->c_str(), O_CREAT | O_EXCL | O_WRONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+		if (file < 0) {
+			if (errno == EEXIST) {
+				return FileCreationError::FileAlreadyExists;
+			}
+			return FileCreationError::UnknownError;
+		}
+
+		close(file);
 		return etl::nullopt;
 	}
 
 	etl::optional<FileDeletionError> deleteFile(const Path& path) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return FileDeletionError::FileDoesNotExist;
+		}
+
+		auto nodeType = getNodeType(path);
+		if (not nodeType) {
+			return FileDeletionError::FileDoesNotExist;
+		}
+
+		if (nodeType.value() != NodeType::File) {
+			return FileDeletionError::PathLeadsToDirectory;
+		}
+
+		if (isLocked(hostPath.value())) {
+			return FileDeletionError::FileIsLocked;
+		}
+
+		if (unlink(hostPath->c_str()) != 0) {
+			return FileDeletionError::UnknownError;
+		}
+
+		return etl::nullopt;
+	}
+
+	etl::result<size_t, FileReadError> readFile(const Path& path, size_t offset, etl::span<uint8_t> buffer) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return FileReadError::FileDoesNotExist;
+		}
+
+		int file = open(hostPath->c_str(), O_RDONLY);
+		if (file < 0) {
+			return errno == ENOENT ? FileReadError::FileDoesNotExist : FileReadError::UnknownError;
+		}
+
+		size_t bytesRead = 0;
+		while (bytesRead < buffer.size()) {
+			ssize_t result = pread(file, buffer.data() + bytesRead, buffer.size() - bytesRead, offset + bytesRead);
+			if (result < 0) {
+				const int error = errno;
+				close(file);
+				return error == EISDIR ? FileReadError::PathLeadsToDirectory : FileReadError::UnknownError;
+			}
+			if (result == 0) {
+				break;
+			}
+			bytesRead += result;
+		}
+
+		close(file);
+		return bytesRead;
+	}
+
+	etl::optional<FileWriteError> writeFile(const Path& path, size_t offset, etl::span<const uint8_t> data) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return FileWriteError::FileDoesNotExist;
+		}
+
+		if (isLocked(hostPath.value())) {
+			return FileWriteError::FileIsLocked;
+		}
+
+		int file = open(hostPath->c_str(), O_WRONLY);
+		if (file < 0) {
+			switch (errno) {
+				case ENOENT:
+					return FileWriteError::FileDoesNotExist;
+				case EISDIR:
+					return FileWriteError::PathLeadsToDirectory;
+				default:
+					return FileWriteError::UnknownError;
+			}
+		}
+
+		size_t bytesWritten = 0;
+		while (bytesWritten < data.size()) {
+			ssize_t result = pwrite(file, data.data() + bytesWritten, data.size() - bytesWritten, offset + bytesWritten);
+			if (result <= 0) {
+				close(file);
+				return FileWriteError::UnknownError;
+			}
+			bytesWritten += result;
+		}
+
+		close(file);
 		return etl::nullopt;
 	}
 
 	etl::optional<NodeType> getNodeType(const Path& path) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return etl::nullopt;
+		}
+
+		struct stat status {};
+		if (stat(hostPath->c_str(), &status) != 0) {
+			return etl::nullopt;
+		}
+
+		if (S_ISREG(status.st_mode)) {
+			return NodeType::File;
+		}
+		if (S_ISDIR(status.st_mode)) {
+			return NodeType::Directory;
+		}
 		return etl::nullopt;
 	}
 
 	FileLockStatus getFileLockStatus(const Path& path) {
+		auto hostPath = toHostPath(path);
+		if (hostPath and isLocked(hostPath.value())) {
+			return FileLockStatus::Locked;
+		}
+
 		return FileLockStatus::Unlocked;
 	}
 
+	/**
+	 * Locks a file by setting its lock extended attribute, or, if the host filesystem does not support user extended
+	 * attributes, by removing the write permission of its owner.
+	 */
 	void lockFile(const Path& path) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return;
+		}
+
+		const uint8_t locked = 1;
+		if (setxattr(hostPath->c_str(), LockAttribute, &locked, sizeof(locked), 0) == 0) {
+			return;
+		}
+
+		struct stat status {};
+		if (stat(hostPath->c_str(), &status) == 0) {
+			chmod(hostPath->c_str(), status.st_mode & ~S_IWUSR & 07777);
+		}
 	}
 
 	void unlockFile(const Path& path) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return;
+		}
+
+		removexattr(hostPath->c_str(), LockAttribute);
+
+		struct stat status {};
+		if (stat(hostPath->c_str(), &status) == 0 and (status.st_mode & S_IWUSR) == 0) {
+			chmod(hostPath->c_str(), (status.st_mode | S_IWUSR) & 07777);
+		}
 	}
 
 	etl::result<Attributes, FileAttributeError> getFileAttributes(const Path& path) {
-		return Attributes{};
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return FileAttributeError::FileDoesNotExist;
+		}
+
+		struct stat status {};
+		if (stat(hostPath->c_str(), &status) != 0) {
+			return FileAttributeError::FileDoesNotExist;
+		}
+
+		if (S_ISDIR(status.st_mode)) {
+			return FileAttributeError::PathLeadsToDirectory;
+		}
+
+		Attributes attributes{};
+		attributes.sizeInBytes = status.st_size;
+		attributes.isLocked = isLocked(hostPath.value());
+
+		return attributes;
+	}
+
+	/**
+	 * Reads a directory with a single directory stream, which is the only memory that the iteration needs.
+	 * Symbolic links and special files are skipped, so that walking a tree can never loop.
+	 */
+	etl::optional<DirectoryReadError> forEachDirectoryEntry(const Path& path,
+	                                                        const std::function<bool(const DirectoryEntry&)>& visitor) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return DirectoryReadError::DirectoryDoesNotExist;
+		}
+
+		DIR* directory = opendir(hostPath->c_str());
+		if (directory == nullptr) {
+			switch (errno) {
+				case ENOENT:
+					return DirectoryReadError::DirectoryDoesNotExist;
+				case ENOTDIR:
+					return DirectoryReadError::PathLeadsToFile;
+				default:
+					return DirectoryReadError::UnknownError;
+			}
+		}
+
+		while (const dirent* entry = readdir(directory)) {
+			if (strcmp(entry->d_name, ".") == 0 or strcmp(entry->d_name, "..") == 0) {
+				continue;
+			}
+
+			etl::optional<NodeType> type;
+			switch (entry->d_type) {
+				case DT_REG:
+					type = NodeType::File;
+					break;
+				case DT_DIR:
+					type = NodeType::Directory;
+					break;
+				case DT_UNKNOWN: {
+					if (hostPath->size() + 1 + strlen(entry->d_name) > hostPath->capacity()) {
+						break;
+					}
+					HostPath entryPath = hostPath.value();
+					entryPath.append("/");
+					entryPath.append(entry->d_name);
+					struct stat status {};
+					if (lstat(entryPath.c_str(), &status) == 0) {
+						if (S_ISREG(status.st_mode)) {
+							type = NodeType::File;
+						} else if (S_ISDIR(status.st_mode)) {
+							type = NodeType::Directory;
+						}
+					}
+					break;
+				}
+				default:
+					break;
+			}
+
+			if (type and not visitor(DirectoryEntry{type.value(), etl::string_view(entry->d_name)})) {
+				break;
+			}
+		}
+
+		closedir(directory);
+		return etl::nullopt;
 	}
 
 	etl::optional<DirectoryCreationError> createDirectory(const Path& path) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return DirectoryCreationError::UnknownError;
+		}
+
+		if (mkdir(hostPath->c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) != 0) {
+			if (errno == EEXIST) {
+				return DirectoryCreationError::DirectoryAlreadyExists;
+			}
+			return DirectoryCreationError::UnknownError;
+		}
+
 		return etl::nullopt;
 	}
 
 	etl::optional<DirectoryDeletionError> deleteDirectory(const Path& path) {
+		auto hostPath = toHostPath(path);
+		if (not hostPath) {
+			return DirectoryDeletionError::DirectoryDoesNotExist;
+		}
+
+		if (rmdir(hostPath->c_str()) != 0) {
+			switch (errno) {
+				case ENOENT:
+				case ENOTDIR:
+					return DirectoryDeletionError::DirectoryDoesNotExist;
+				case ENOTEMPTY:
+				case EEXIST:
+					return DirectoryDeletionError::DirectoryIsNotEmpty;
+				default:
+					return DirectoryDeletionError::UnknownError;
+			}
+		}
+
 		return etl::nullopt;
 	}
 } // namespace Filesystem
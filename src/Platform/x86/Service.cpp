@@ -1,4 +1,5 @@
 #include "Service.hpp"
+#include "ServicePool.hpp"
 #include <Logger.hpp>
 #include <MessageParser.hpp>
 #include <arpa/inet.h>
@@ -62,6 +63,14 @@ void Service::storeMessage(Message& message) {
 	}
 
 
+#ifdef SERVICE_REALTIMEFORWARDINGCONTROL
+	// Apply the ST[14] forwarding filters before anything is transmitted
+	if (message.packetType == Message::TM and not Services.realTimeForwarding.forwardReport(message)) {
+		LOG_DEBUG << ss.str() << "(not forwarded)";
+		return;
+	}
+#endif
+
 	// Send data to YAMCS port
 	if constexpr (SendToYamcs) {
 		packetSender.sendPacketToYamcs(message);
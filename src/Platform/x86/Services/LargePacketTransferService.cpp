@@ -0,0 +1,25 @@
+#include "ECSS_Configuration.hpp"
+#ifdef SERVICE_LARGEPACKET
+
+#include <algorithm>
+#include "MessageParser.hpp"
+#include "Services/LargePacketTransferService.hpp"
+
+/**
+ * On x86, a reassembled large packet is treated as a CCSDS space packet carrying a TC, which is executed as if it had
+ * been received directly. Packets that do not fit in a CCSDS packet are refused.
+ */
+bool LargePacketTransferService::largePacketReassembled(LargeMessageTransactionId largeMessageTransactionIdentifier,
+                                                        etl::span<const uint8_t> packet) {
+	if (packet.size() > CCSDSMaxMessageSize) {
+		return false;
+	}
+
+	uint8_t packetData[CCSDSMaxMessageSize];
+	std::copy(packet.begin(), packet.end(), packetData);
+	Message message = MessageParser::parse(packetData, packet.size());
+	MessageParser::execute(message);
+	return true;
+}
+
+#endif
@@ -1,6 +1,7 @@
 #include "ECSS_Configuration.hpp"
 #ifdef SERVICE_EVENTACTION
 
+#include <algorithm>
 #include "Message.hpp"
 #include "MessageParser.hpp"
 #include "Services/EventActionService.hpp"
@@ -8,6 +9,26 @@
 EventActionService::EventActionDefinition::EventActionDefinition(ApplicationProcessId applicationID, EventDefinitionId eventDefinitionID, Message& message)
     : applicationID(applicationID), eventDefinitionID(eventDefinitionID), request(message.data + message.readPosition) {
 	message.readPosition += ECSSTCRequestStringSize;
+
+	const auto* header = reinterpret_cast<const uint8_t*>(request.data());
+	actionHeaderIsValid = (header[0] >> 4) == ECSSPUSVersion;
+	actionServiceType = header[1];
+	actionMessageType = header[2];
+	actionSourceId = (header[3] << 8) + header[4];
+}
+
+void EventActionService::EventActionDefinition::buildAction(Message& action) const {
+	action.packetType = Message::TC;
+	action.serviceType = actionServiceType;
+	action.messageType = actionMessageType;
+	action.sourceId = actionSourceId;
+	action.applicationId = 0;
+
+	const auto* data = reinterpret_cast<const uint8_t*>(request.data()) + ECSSSecondaryTCHeaderSize;
+	std::copy(data, data + ActionDataSize, action.data);
+	action.dataSize = ActionDataSize;
+
+	ErrorHandler::assertRequest(actionHeaderIsValid, action, ErrorHandler::UnacceptableMessage);
 }
 
 void EventActionService::addEventActionDefinitions(Message& message) {
@@ -20,15 +41,13 @@ void EventActionService::addEventActionDefinitions(Message& message) {
 		EventDefinitionId eventDefinitionID = message.read<EventDefinitionId>();
 		bool canBeAdded = true;
 
-		for (auto& element: eventActionDefinitionMap) {
-			if (element.first == eventDefinitionID) {
-				if (element.second.enabled) {
-					canBeAdded = false;
-					ErrorHandler::reportError(message, ErrorHandler::EventActionEnabledError);
-				} else {
-					eventActionDefinitionMap.erase(eventDefinitionID);
-				}
-				break;
+		auto element = eventActionDefinitionMap.find(eventDefinitionID);
+		if (element != eventActionDefinitionMap.end()) {
+			if (element->second.enabled) {
+				canBeAdded = false;
+				ErrorHandler::reportError(message, ErrorHandler::EventActionEnabledError);
+			} else {
+				eventActionDefinitionMap.erase(element);
 			}
 		}
 		if (canBeAdded) {
@@ -50,23 +69,13 @@ void EventActionService::deleteEventActionDefinitions(Message& message) {
 	while (numberOfEventActionDefinitions-- != 0) {
 		ApplicationProcessId applicationID = message.read<ApplicationProcessId>();
 		EventDefinitionId eventDefinitionID = message.read<EventDefinitionId>();
-		bool actionDefinitionExists = false;
-
-		for (auto& element: eventActionDefinitionMap) {
-			if (element.first == eventDefinitionID) {
-				actionDefinitionExists = true;
-				if (element.second.applicationID != applicationID) {
-					ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionError);
-				} else if (element.second.enabled) {
-					ErrorHandler::reportError(message, ErrorHandler::EventActionDeleteEnabledDefinitionError);
-				} else {
-					eventActionDefinitionMap.erase(eventActionDefinitionMap.find(eventDefinitionID));
-				}
-				break;
-			}
-		}
-		if (not actionDefinitionExists) {
+		auto element = eventActionDefinitionMap.find(eventDefinitionID);
+		if (element == eventActionDefinitionMap.end() or element->second.applicationID != applicationID) {
 			ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionError);
+		} else if (element->second.enabled) {
+			ErrorHandler::reportError(message, ErrorHandler::EventActionDeleteEnabledDefinitionError);
+		} else {
+			eventActionDefinitionMap.erase(element);
 		}
 	}
 }
@@ -88,21 +97,11 @@ void EventActionService::enableEventActionDefinitions(Message& message) {
 		while (numberOfEventActionDefinitions-- != 0) {
 			ApplicationProcessId applicationID = message.read<ApplicationProcessId>();
 			EventDefinitionId eventDefinitionID = message.read<EventDefinitionId>();
-			bool actionDefinitionExists = false;
-
-			for (auto& element: eventActionDefinitionMap) {
-				if (element.first == eventDefinitionID) {
-					actionDefinitionExists = true;
-					if (element.second.applicationID != applicationID) {
-						ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionError);
-					} else {
-						element.second.enabled = true;
-					}
-					break;
-				}
-			}
-			if (not actionDefinitionExists) {
+			auto element = eventActionDefinitionMap.find(eventDefinitionID);
+			if (element == eventActionDefinitionMap.end() or element->second.applicationID != applicationID) {
 				ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionError);
+			} else {
+				element->second.enabled = true;
 			}
 		}
 	} else {
@@ -121,21 +120,11 @@ void EventActionService::disableEventActionDefinitions(Message& message) {
 		while (numberOfEventActionDefinitions-- != 0) {
 			ApplicationProcessId applicationID = message.read<ApplicationProcessId>();
 			EventDefinitionId eventDefinitionID = message.read<EventDefinitionId>();
-			bool actionDefinitionExists = false;
-
-			for (auto& element: eventActionDefinitionMap) {
-				if (element.first == eventDefinitionID) {
-					actionDefinitionExists = true;
-					if (element.second.applicationID != applicationID) {
-						ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionError);
-					} else {
-						element.second.enabled = false;
-					}
-					break;
-				}
-			}
-			if (not actionDefinitionExists) {
+			auto element = eventActionDefinitionMap.find(eventDefinitionID);
+			if (element == eventActionDefinitionMap.end() or element->second.applicationID != applicationID) {
 				ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionError);
+			} else {
+				element->second.enabled = false;
 			}
 		}
 	} else {
@@ -181,16 +170,39 @@ void EventActionService::disableEventActionFunction(Message& message) {
 void EventActionService::executeAction(EventDefinitionId eventDefinitionID) {
 	// Custom function
 	if (eventActionFunctionStatus) {
-		auto range = eventActionDefinitionMap.equal_range(eventDefinitionID);
-		for (auto& element = range.first; element != range.second; ++element) {
-			if (element->second.enabled) {
-				Message message = MessageParser::parseECSSTC(element->second.request);
-				MessageParser::execute(message);
-			}
+		auto element = eventActionDefinitionMap.find(eventDefinitionID);
+		if (element != eventActionDefinitionMap.end() and element->second.enabled) {
+			// The action is built before it runs, since it may itself delete or replace its definition
+			Message action;
+			element->second.buildAction(action);
+			MessageParser::execute(action);
 		}
 	}
 }
 
+void EventActionService::queueAction(EventDefinitionId eventDefinitionID) {
+	if (not eventActionFunctionStatus) {
+		return;
+	}
+	auto element = eventActionDefinitionMap.find(eventDefinitionID);
+	if (element == eventActionDefinitionMap.end() or not element->second.enabled) {
+		return;
+	}
+	if (pendingActions.full()) {
+		droppedActionCount++;
+		return;
+	}
+	pendingActions.push(eventDefinitionID);
+}
+
+void EventActionService::executePendingActions() {
+	for (auto actionCount = pendingActions.size(); actionCount > 0; actionCount--) {
+		const EventDefinitionId eventDefinitionID = pendingActions.front();
+		pendingActions.pop();
+		executeAction(eventDefinitionID);
+	}
+}
+
 void EventActionService::execute(Message& message) {
 	switch (message.messageType) {
 		case AddEventAction:
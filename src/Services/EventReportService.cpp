@@ -1,9 +1,11 @@
 #include "ECSS_Configuration.hpp"
 #ifdef SERVICE_EVENTREPORT
 
-#include <Services/EventActionService.hpp>
 #include <Services/EventReportService.hpp>
+#include <limits>
+#include "Helpers/TimeGetter.hpp"
 #include "Message.hpp"
+#include "ServicePool.hpp"
 
 /**
  * @todo: Add message type in TCs
@@ -11,63 +13,221 @@
  */
 void EventReportService::informativeEventReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
 	// TM[5,1]
-	if (stateOfEvents[static_cast<EventDefinitionId>(eventID)]) {
-		Message report = createTM(EventReportService::MessageType::InformativeEventReport);
-		report.append<EventDefinitionId>(eventID);
-		report.appendString(data);
-		EventActionService eventActionService;
-		eventActionService.executeAction(eventID);
-
-		storeMessage(report);
-	}
+	reportEvent(eventID, InformativeEventReport, data, nullptr);
 }
 
 void EventReportService::lowSeverityAnomalyReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
-	lowSeverityEventCount++;
 	// TM[5,2]
-	if (stateOfEvents[static_cast<EventDefinitionId>(eventID)]) {
-		lowSeverityReportCount++;
-		Message report = createTM(EventReportService::MessageType::LowSeverityAnomalyReport);
-		report.append<EventDefinitionId>(eventID);
-		report.appendString(data);
-		lastLowSeverityReportID = static_cast<EventDefinitionId>(eventID);
-
-		storeMessage(report);
-		EventActionService eventActionService;
-		eventActionService.executeAction(eventID);
-	}
+	reportEvent(eventID, LowSeverityAnomalyReport, data, nullptr);
 }
 
 void EventReportService::mediumSeverityAnomalyReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
-	mediumSeverityEventCount++;
 	// TM[5,3]
-	if (stateOfEvents[static_cast<EventDefinitionId>(eventID)]) {
-		mediumSeverityReportCount++;
-		Message report = createTM(EventReportService::MessageType::MediumSeverityAnomalyReport);
-		report.append<EventDefinitionId>(eventID);
-		report.appendString(data);
-		lastMediumSeverityReportID = static_cast<EventDefinitionId>(eventID);
-
-		storeMessage(report);
-		EventActionService eventActionService;
-		eventActionService.executeAction(eventID);
-	}
+	reportEvent(eventID, MediumSeverityAnomalyReport, data, nullptr);
 }
 
 void EventReportService::highSeverityAnomalyReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
-	highSeverityEventCount++;
 	// TM[5,4]
-	if (stateOfEvents[static_cast<EventDefinitionId>(eventID)]) {
-		highSeverityReportCount++;
-		Message report = createTM(EventReportService::MessageType::HighSeverityAnomalyReport);
+	reportEvent(eventID, HighSeverityAnomalyReport, data, nullptr);
+}
+
+bool EventReportService::setEventReportType(Event eventID, MessageType reportType) {
+	if (eventID >= numberOfEvents or reportType < InformativeEventReport or reportType > HighSeverityAnomalyReport) {
+		return false;
+	}
+	eventReportTypes[eventID] = reportType;
+	return true;
+}
+
+void EventReportService::eventReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
+	if (eventID >= numberOfEvents) {
+		return;
+	}
+	reportEvent(eventID, eventReportTypes[eventID], data, nullptr);
+}
+
+void EventReportService::reportEvent(Event eventID, MessageType reportType, const String<ECSSEventDataAuxiliaryMaxSize>& data,
+                                     const Time::DefaultCUC* occurrenceTime) {
+	switch (reportType) {
+		case LowSeverityAnomalyReport:
+			lowSeverityEventCount++;
+			break;
+		case MediumSeverityAnomalyReport:
+			mediumSeverityEventCount++;
+			break;
+		case HighSeverityAnomalyReport:
+			highSeverityEventCount++;
+			break;
+		default:
+			break;
+	}
+
+	if (not stateOfEvents[static_cast<EventDefinitionId>(eventID)]) {
+		return;
+	}
+
+	if (admitEventReport(eventID, reportType, occurrenceTime)) {
+		switch (reportType) {
+			case LowSeverityAnomalyReport:
+				lowSeverityReportCount++;
+				lastLowSeverityReportID = static_cast<EventDefinitionId>(eventID);
+				break;
+			case MediumSeverityAnomalyReport:
+				mediumSeverityReportCount++;
+				lastMediumSeverityReportID = static_cast<EventDefinitionId>(eventID);
+				break;
+			case HighSeverityAnomalyReport:
+				highSeverityReportCount++;
+				lastHighSeverityReportID = static_cast<EventDefinitionId>(eventID);
+				break;
+			default:
+				break;
+		}
+
+		Message report = createTM(reportType);
 		report.append<EventDefinitionId>(eventID);
 		report.appendString(data);
-		lastHighSeverityReportID = static_cast<EventDefinitionId>(eventID);
 
 		storeMessage(report);
-		EventActionService eventActionService;
-		eventActionService.executeAction(eventID);
 	}
+#ifdef SERVICE_EVENTACTION
+	Services.eventAction.queueAction(eventID);
+#endif
+}
+
+bool EventReportService::raiseEvent(Event eventID, MessageType reportType, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
+	if (eventID >= numberOfEvents or reportType < InformativeEventReport or reportType > HighSeverityAnomalyReport) {
+		return false;
+	}
+
+	EventRecord record;
+	record.eventID = eventID;
+	record.reportType = reportType;
+	record.dataSize = data.size();
+	std::copy(data.begin(), data.end(), record.data.begin());
+	record.occurrenceTime = TimeGetter::getCurrentTimeDefaultCUC();
+
+	if (not raisedEvents.push(record)) {
+		droppedRaisedEventCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	return true;
+}
+
+size_t EventReportService::processRaisedEvents(size_t maximumEvents) {
+	size_t processedEvents = 0;
+	EventRecord record;
+	while (processedEvents < maximumEvents and raisedEvents.pop(record)) {
+		const String<ECSSEventDataAuxiliaryMaxSize> data(record.data.data(), record.dataSize);
+		reportEvent(static_cast<Event>(record.eventID), static_cast<MessageType>(record.reportType), data,
+		            &record.occurrenceTime);
+		processedEvents++;
+	}
+	return processedEvents;
+}
+
+bool EventReportService::admitEventReport(Event eventID, MessageType reportType, const Time::DefaultCUC* occurrenceTime) {
+	const EventRateLimit& limit = rateLimits[reportType - InformativeEventReport];
+	if (limit.burstSize == 0 or eventID >= numberOfEvents) {
+		return true;
+	}
+
+	EventRateState& state = rateStates[eventID];
+	state.reportType = reportType;
+	if (state.usedTokens < limit.burstSize and state.suppressedOccurrences == 0) {
+		if (state.usedTokens == 0) {
+			state.lastRefillTime = rateLimitTime;
+		}
+		state.usedTokens++;
+		return true;
+	}
+
+	const Time::DefaultCUC time = (occurrenceTime != nullptr) ? *occurrenceTime : TimeGetter::getCurrentTimeDefaultCUC();
+	if (state.suppressedOccurrences == 0) {
+		state.firstSuppressedTime = time;
+	}
+	state.lastSuppressedTime = time;
+	if (state.suppressedOccurrences < std::numeric_limits<uint16_t>::max()) {
+		state.suppressedOccurrences++;
+	}
+	suppressedReportCount(reportType)++;
+	return false;
+}
+
+uint16_t& EventReportService::suppressedReportCount(MessageTypeNum reportType) {
+	switch (reportType) {
+		case LowSeverityAnomalyReport:
+			return lowSeveritySuppressedCount;
+		case MediumSeverityAnomalyReport:
+			return mediumSeveritySuppressedCount;
+		case HighSeverityAnomalyReport:
+			return highSeveritySuppressedCount;
+		default:
+			return informativeSuppressedCount;
+	}
+}
+
+void EventReportService::coalescedEventReport(EventDefinitionId eventID, EventRateState& state) {
+	// TM[5,1] to TM[5,4], depending on the severity of the event
+	Message report = createTM(state.reportType);
+	report.append<EventDefinitionId>(SuppressedEventOccurrences);
+	report.append<EventDefinitionId>(eventID);
+	report.appendUint16(state.suppressedOccurrences);
+	report.appendDefaultCUCTimeStamp(state.firstSuppressedTime);
+	report.appendDefaultCUCTimeStamp(state.lastSuppressedTime);
+
+	storeMessage(report);
+	coalescedReportCount++;
+	state.suppressedOccurrences = 0;
+}
+
+void EventReportService::setRateLimit(MessageType reportType, uint16_t burstSize, TimeStamps refillInterval) {
+	if (reportType < InformativeEventReport or reportType > HighSeverityAnomalyReport) {
+		ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
+		return;
+	}
+	rateLimits[reportType - InformativeEventReport] = {burstSize, refillInterval};
+}
+
+TimeStamps EventReportService::updateRateLimits(TimeStamps currentTime) {
+	rateLimitTime = currentTime;
+	TimeStamps nextWakeUp = std::numeric_limits<TimeStamps>::max();
+
+	for (EventDefinitionId eventID = 0; eventID < numberOfEvents; eventID++) {
+		EventRateState& state = rateStates[eventID];
+		if (state.usedTokens == 0 and state.suppressedOccurrences == 0) {
+			continue;
+		}
+		const EventRateLimit& limit = rateLimits[state.reportType - InformativeEventReport];
+
+		if (limit.burstSize == 0 or limit.refillInterval == 0) {
+			state.usedTokens = 0;
+		} else {
+			const TimeStamps regainedTokens = (currentTime - state.lastRefillTime) / limit.refillInterval;
+			if (regainedTokens >= state.usedTokens) {
+				state.usedTokens = 0;
+			} else {
+				state.usedTokens -= regainedTokens;
+			}
+			state.lastRefillTime += regainedTokens * limit.refillInterval;
+		}
+
+		if (state.suppressedOccurrences != 0 and (limit.burstSize == 0 or state.usedTokens < limit.burstSize)) {
+			if (state.usedTokens == 0) {
+				state.lastRefillTime = currentTime;
+			}
+			if (limit.burstSize != 0) {
+				state.usedTokens++;
+			}
+			coalescedEventReport(eventID, state);
+		}
+
+		if (state.usedTokens != 0 and limit.refillInterval != 0) {
+			nextWakeUp = std::min(nextWakeUp, state.lastRefillTime + limit.refillInterval - currentTime);
+		}
+	}
+
+	return nextWakeUp;
 }
 
 void EventReportService::enableReportGeneration(Message message) {
@@ -1,8 +1,11 @@
 #include "Services/FileManagementService.hpp"
+#include <algorithm>
 #include "ErrorHandler.hpp"
 #include "Helpers/FilepathValidators.hpp"
 #include "Helpers/Filesystem.hpp"
+#include "Helpers/TimeGetter.hpp"
 #include "Message.hpp"
+#include "ServicePool.hpp"
 
 using namespace FilepathValidators;
 
@@ -144,6 +147,378 @@ void FileManagementService::fileAttributeReport(const ObjectPath& repositoryPath
 	storeMessage(report);
 }
 
+etl::optional<Filesystem::Path> FileManagementService::readFileContentPath(Message& message, ObjectPath& repositoryPath,
+                                                                          ObjectPath& fileName) {
+	repositoryPath = message.readOctetString<Filesystem::ObjectPathSize>();
+	fileName = message.readOctetString<Filesystem::ObjectPathSize>();
+	auto fullPath = getFullPath(repositoryPath, fileName);
+
+	if (findWildcardPosition(fullPath)) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::UnexpectedWildcard);
+		return etl::nullopt;
+	}
+
+	auto nodeType = Filesystem::getNodeType(fullPath);
+	if (not nodeType) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::ObjectDoesNotExist);
+		return etl::nullopt;
+	}
+
+	if (nodeType.value() != Filesystem::NodeType::File) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::AttemptedContentAccessOnDirectory);
+		return etl::nullopt;
+	}
+
+	return fullPath;
+}
+
+template <typename Sink>
+bool FileManagementService::streamFileContent(Message& request, const Path& path, const ObjectPath& repositoryPath,
+                                              const ObjectPath& fileName, size_t start, size_t end, Sink&& sink) {
+	size_t chunkStart = start;
+	do {
+		const auto chunkSize = static_cast<uint16_t>(std::min(end - chunkStart, static_cast<size_t>(MaxFileChunkSize)));
+
+		Message report = createTM(MessageType::FileContentReport);
+		report.appendOctetString(repositoryPath);
+		report.appendOctetString(fileName);
+		report.appendUint32(chunkStart);
+
+		// The chunk is read straight after its length field, so that it is not copied again
+		uint8_t* chunk = report.data + report.dataSize + sizeof(uint16_t);
+		auto bytesRead = Filesystem::readFile(path, chunkStart, etl::span<uint8_t>(chunk, chunkSize));
+		if (bytesRead.is_error() or bytesRead.value() != chunkSize) {
+			ErrorHandler::reportError(request, ErrorHandler::ExecutionCompletionErrorType::UnknownExecutionCompletionError);
+			return false;
+		}
+		report.appendUint16(chunkSize);
+		report.dataSize += chunkSize;
+
+		sink(report);
+		chunkStart += chunkSize;
+	} while (chunkStart < end);
+
+	return true;
+}
+
+void FileManagementService::writeFileContent(Message& message) {
+	message.assertTC(ServiceType, WriteFileContent);
+
+	ObjectPath repositoryPath;
+	ObjectPath fileName;
+	auto fullPath = readFileContentPath(message, repositoryPath, fileName);
+	if (not fullPath) {
+		return;
+	}
+
+	uint32_t offset = message.readUint32();
+	uint16_t dataLength = message.readUint16();
+	if (static_cast<uint64_t>(offset) + dataLength > MaxPossibleFileSizeBytes) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::SizeOfFileIsOutOfBounds);
+		return;
+	}
+
+	if (not ErrorHandler::assertRequest(message.readPosition + dataLength <= ECSSMaxMessageSize, message,
+	                                    ErrorHandler::MessageTooShort)) {
+		return;
+	}
+
+	auto fileWriteError = Filesystem::writeFile(fullPath.value(), offset,
+	                                            etl::span<const uint8_t>(message.data + message.readPosition, dataLength));
+	message.skipBytes(dataLength);
+	if (not fileWriteError) {
+		return;
+	}
+
+	using Filesystem::FileWriteError;
+	switch (fileWriteError.value()) {
+		case FileWriteError::FileDoesNotExist:
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::ObjectDoesNotExist);
+			break;
+		case FileWriteError::PathLeadsToDirectory:
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::AttemptedContentAccessOnDirectory);
+			break;
+		case FileWriteError::FileIsLocked:
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::AttemptedWriteOnLockedFile);
+			break;
+		default:
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::UnknownExecutionCompletionError);
+			break;
+	}
+}
+
+void FileManagementService::readFileContent(Message& message) {
+	message.assertTC(ServiceType, ReadFileContent);
+
+	ObjectPath repositoryPath;
+	ObjectPath fileName;
+	auto fullPath = readFileContentPath(message, repositoryPath, fileName);
+	if (not fullPath) {
+		return;
+	}
+
+	uint32_t offset = message.readUint32();
+	uint32_t length = message.readUint32();
+
+	auto attributes = Filesystem::getFileAttributes(fullPath.value());
+	if (attributes.is_error()) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::UnknownExecutionCompletionError);
+		return;
+	}
+
+	const size_t fileSize = attributes.value().sizeInBytes;
+	if (offset > fileSize) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::FileOffsetIsOutOfBounds);
+		return;
+	}
+
+	const size_t end = (length == 0) ? fileSize : std::min(fileSize, static_cast<size_t>(offset) + length);
+	streamFileContent(message, fullPath.value(), repositoryPath, fileName, offset, end, [this](Message& report) {
+		storeMessage(report);
+	});
+}
+
+void FileManagementService::transferFileToPacketStore(Message& message) {
+	message.assertTC(ServiceType, TransferFileToPacketStore);
+
+#ifdef SERVICE_STORAGEANDRETRIEVAL
+	ObjectPath repositoryPath;
+	ObjectPath fileName;
+	auto fullPath = readFileContentPath(message, repositoryPath, fileName);
+	if (not fullPath) {
+		return;
+	}
+
+	uint8_t packetStoreIdBytes[ECSSPacketStoreIdSize];
+	message.readString(packetStoreIdBytes, ECSSPacketStoreIdSize);
+	const String<ECSSPacketStoreIdSize> packetStoreId(packetStoreIdBytes);
+
+	auto& storageAndRetrieval = Services.storageAndRetrieval;
+	if (not storageAndRetrieval.packetStoreExists(packetStoreId)) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::NonExistingPacketStore);
+		return;
+	}
+
+	auto attributes = Filesystem::getFileAttributes(fullPath.value());
+	if (attributes.is_error()) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::UnknownExecutionCompletionError);
+		return;
+	}
+
+	auto& packetStore = storageAndRetrieval.getPacketStore(packetStoreId);
+	if (not packetStore.storageStatus) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::PacketStoreStorageIsDisabled);
+		return;
+	}
+
+	const size_t fileSize = attributes.value().sizeInBytes;
+	const size_t reports = std::max<size_t>(1, (fileSize + MaxFileChunkSize - 1) / MaxFileChunkSize);
+	// Every report repeats the two paths, with their lengths, the offset and the length of its chunk
+	const uint64_t reportHeaderSize =
+	    2 * sizeof(uint16_t) + repositoryPath.size() + fileName.size() + sizeof(uint32_t) + sizeof(uint16_t);
+	const uint64_t transferSize = fileSize + reports * reportHeaderSize;
+	auto& storedTelemetryPackets = packetStore.storedTelemetryPackets;
+	if (storedTelemetryPackets.available() < reports or
+	    packetStore.calculateSizeInBytes() + transferSize > packetStore.sizeInBytes) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::PacketStoreCannotHoldFile);
+		return;
+	}
+
+	const auto timestamp = static_cast<TimeStamps>(TimeGetter::getCurrentTimeDefaultCUC().asDuration().count());
+	streamFileContent(message, fullPath.value(), repositoryPath, fileName, 0, fileSize,
+	                  [&storedTelemetryPackets, timestamp](Message& report) {
+		                  storedTelemetryPackets.push_back({timestamp, report});
+	                  });
+#else
+	ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::SubServiceExecutionStartError);
+#endif
+}
+
+/**
+ * A list of objects, reported with as many TM packets as needed. Each report is stored as soon as the next object does
+ * not fit in it, so only one report is kept in memory. Every report starts with two paths and the number of objects
+ * that it contains.
+ */
+class FileManagementService::ObjectListReport {
+	FileManagementService& service;
+	MessageType messageType;
+	const ObjectPath& firstPath;
+	const ObjectPath& secondPath;
+	Message report;
+	uint16_t countPosition = 0;
+	uint16_t count = 0;
+
+	void start() {
+		report = service.createTM(messageType);
+		report.appendOctetString(firstPath);
+		report.appendOctetString(secondPath);
+		countPosition = report.dataSize;
+		report.appendUint16(0);
+		count = 0;
+	}
+
+	/**
+	 * Writes the number of objects in the report, and stores it
+	 */
+	void store() {
+		const uint16_t dataSize = report.dataSize;
+		report.dataSize = countPosition;
+		report.appendUint16(count);
+		report.dataSize = dataSize;
+		service.storeMessage(report);
+	}
+
+	/**
+	 * Appends an octet string straight from the name of an object, which reserve() has made room for
+	 */
+	void appendOctetString(etl::string_view string) {
+		report.appendUint16(string.size());
+		std::copy(string.begin(), string.end(), report.data + report.dataSize);
+		report.dataSize += string.size();
+	}
+
+	/**
+	 * Makes room in the report for an object of \p size bytes, storing the report and starting a new one if needed
+	 */
+	void reserve(size_t size) {
+		if (report.dataSize + size >= ECSSMaxMessageSize) {
+			store();
+			start();
+		}
+		count++;
+	}
+
+public:
+	ObjectListReport(FileManagementService& service, MessageType messageType, const ObjectPath& firstPath,
+	                 const ObjectPath& secondPath)
+	    : service(service), messageType(messageType), firstPath(firstPath), secondPath(secondPath) {
+		start();
+	}
+
+	void append(etl::string_view path) {
+		reserve(sizeof(uint16_t) + path.size());
+		appendOctetString(path);
+	}
+
+	void append(Filesystem::NodeType type, etl::string_view name) {
+		reserve(sizeof(uint8_t) + sizeof(uint16_t) + name.size());
+		report.appendEnum8(static_cast<uint8_t>(type));
+		appendOctetString(name);
+	}
+
+	/**
+	 * Stores the last report, which is empty if there were no objects at all
+	 */
+	void finish() {
+		store();
+	}
+};
+
+template <typename Visitor>
+bool FileManagementService::walkDirectory(Path& path, uint8_t depth, Visitor& visitor) {
+	struct Walk {
+		FileManagementService& service;
+		Path& path;
+		uint8_t depth;
+		Visitor& visitor;
+		bool stopped;
+	} walk{*this, path, depth, visitor, false};
+
+	// Only a reference to the walk is captured, so that the visitor fits in std::function without allocating
+	Filesystem::forEachDirectoryEntry(path, [&walk](const Filesystem::DirectoryEntry& entry) {
+		const size_t directorySize = walk.path.size();
+		if (directorySize + 1 + entry.name.size() > walk.path.capacity()) {
+			return true;
+		}
+
+		walk.path.append("/");
+		walk.path.append(entry.name.data(), entry.name.size());
+		walk.stopped = not walk.visitor(walk.path, entry.type);
+		if (not walk.stopped and entry.type == Filesystem::NodeType::Directory and walk.depth < MaxSearchDepth) {
+			walk.stopped = not walk.service.walkDirectory(walk.path, walk.depth + 1, walk.visitor);
+		}
+		walk.path.resize(directorySize);
+
+		return not walk.stopped;
+	});
+
+	return not walk.stopped;
+}
+
+void FileManagementService::findFiles(Message& message) {
+	message.assertTC(ServiceType, FindFile);
+
+	auto repositoryPath = message.readOctetString<Filesystem::ObjectPathSize>();
+	auto searchPattern = message.readOctetString<Filesystem::ObjectPathSize>();
+	etl::trim_from_left(repositoryPath, "/");
+	etl::trim_from_right(repositoryPath, "/");
+	etl::trim_from_left(searchPattern, "/");
+
+	Path path = repositoryPath.data();
+	if (findWildcardPosition(path)) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::UnexpectedWildcard);
+		return;
+	}
+
+	auto repositoryType = Filesystem::getNodeType(path);
+	if (not repositoryType) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::ObjectDoesNotExist);
+		return;
+	}
+
+	if (repositoryType.value() != Filesystem::NodeType::Directory) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::RepositoryPathLeadsToFile);
+		return;
+	}
+
+	ObjectListReport report(*this, MessageType::FoundFileReport, repositoryPath, searchPattern);
+	const etl::string_view pattern(searchPattern.data(), searchPattern.size());
+	const size_t relativePathStart = path.size() + 1;
+	uint16_t foundFiles = 0;
+	auto visitor = [&](const Path& objectPath, Filesystem::NodeType type) {
+		const etl::string_view relativePath(objectPath.data() + relativePathStart, objectPath.size() - relativePathStart);
+		if (type == Filesystem::NodeType::File and matchesWildcardPattern(pattern, relativePath)) {
+			report.append(relativePath);
+			foundFiles++;
+		}
+		return foundFiles < MaxReportedObjects;
+	};
+	walkDirectory(path, 0, visitor);
+	report.finish();
+}
+
+void FileManagementService::reportSummaryDirectory(Message& message) {
+	message.assertTC(ServiceType, ReportSummaryDirectory);
+
+	auto repositoryPath = message.readOctetString<Filesystem::ObjectPathSize>();
+	auto directoryPath = message.readOctetString<Filesystem::ObjectPathSize>();
+	auto fullPath = getFullPath(repositoryPath, directoryPath);
+
+	if (findWildcardPosition(fullPath)) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::UnexpectedWildcard);
+		return;
+	}
+
+	auto nodeType = Filesystem::getNodeType(fullPath);
+	if (not nodeType) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::ObjectDoesNotExist);
+		return;
+	}
+
+	if (nodeType.value() != Filesystem::NodeType::Directory) {
+		ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::AttemptedSummaryOfFile);
+		return;
+	}
+
+	ObjectListReport report(*this, MessageType::SummaryDirectoryReport, repositoryPath, directoryPath);
+	uint16_t reportedObjects = 0;
+	Filesystem::forEachDirectoryEntry(fullPath, [&report, &reportedObjects](const Filesystem::DirectoryEntry& entry) {
+		report.append(entry.type, entry.name);
+		return ++reportedObjects < MaxReportedObjects;
+	});
+	report.finish();
+}
+
 void FileManagementService::execute(Message& message) {
 	switch (message.messageType) {
 		case CreateFile:
@@ -161,6 +536,21 @@ void FileManagementService::execute(Message& message) {
 		case DeleteDirectory:
 			deleteDirectory(message);
 			break;
+		case WriteFileContent:
+			writeFileContent(message);
+			break;
+		case ReadFileContent:
+			readFileContent(message);
+			break;
+		case TransferFileToPacketStore:
+			transferFileToPacketStore(message);
+			break;
+		case FindFile:
+			findFiles(message);
+			break;
+		case ReportSummaryDirectory:
+			reportSummaryDirectory(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
@@ -2,7 +2,11 @@
 #ifdef SERVICE_LARGEPACKET
 
 #include <Services/LargePacketTransferService.hpp>
+#include <algorithm>
 #include <etl/String.hpp>
+#include <limits>
+#include "Helpers/PacketStore.hpp"
+#include "Helpers/TimeGetter.hpp"
 #include "Message.hpp"
 
 void LargePacketTransferService::firstDownlinkPartReport(LargeMessageTransactionId largeMessageTransactionIdentifier,
@@ -36,54 +40,190 @@ void LargePacketTransferService::lastDownlinkPartReport(LargeMessageTransactionI
 	storeMessage(report);
 }
 
-String<ECSSMaxFixedOctetStringSize>
-LargePacketTransferService::firstUplinkPart(const String<ECSSMaxFixedOctetStringSize>& string) {
-	return string;
+template <typename PartReader>
+bool LargePacketTransferService::splitPayload(LargeMessageTransactionId largeMessageTransactionIdentifier,
+                                              size_t payloadSize, PartReader&& readPart) {
+	const size_t parts = (payloadSize + PartSize - 1) / PartSize;
+	if (parts > static_cast<size_t>(std::numeric_limits<PartSequenceNum>::max()) + 1) {
+		return false;
+	}
+
+	size_t remainingBytes = payloadSize;
+	for (size_t part = 0; part < parts; part++) {
+		MessageType messageType = InternalDownlinkPartReport;
+		if (part == parts - 1) {
+			messageType = LastDownlinkPartReport;
+		} else if (part == 0) {
+			messageType = FirstDownlinkPartReport;
+		}
+		const auto partSize = static_cast<uint16_t>(std::min(remainingBytes, static_cast<size_t>(PartSize)));
+
+		Message report = createTM(messageType);
+		report.append<LargeMessageTransactionId>(largeMessageTransactionIdentifier);
+		report.append<PartSequenceNum>(static_cast<PartSequenceNum>(part));
+
+		// The part is read straight after its length field, so that it is not copied again
+		uint8_t* partData = report.data + report.dataSize + sizeof(uint16_t);
+		if (not readPart(etl::span<uint8_t>(partData, partSize))) {
+			return false;
+		}
+		report.appendUint16(partSize);
+		report.dataSize += partSize;
+
+		storeMessage(report);
+		remainingBytes -= partSize;
+	}
+
+	return true;
 }
 
-String<ECSSMaxFixedOctetStringSize>
-LargePacketTransferService::intermediateUplinkPart(const String<ECSSMaxFixedOctetStringSize>& string) {
-	return string;
+void LargePacketTransferService::split(Message& message, LargeMessageTransactionId largeMessageTransactionIdentifier) {
+	split(etl::span<const uint8_t>(message.data, message.dataSize), largeMessageTransactionIdentifier);
 }
 
-String<ECSSMaxFixedOctetStringSize>
-LargePacketTransferService::lastUplinkPart(const String<ECSSMaxFixedOctetStringSize>& string) {
-	return string;
+bool LargePacketTransferService::split(etl::span<const uint8_t> payload,
+                                       LargeMessageTransactionId largeMessageTransactionIdentifier) {
+	const uint8_t* nextByte = payload.data();
+	return splitPayload(largeMessageTransactionIdentifier, payload.size(), [&nextByte](etl::span<uint8_t> part) {
+		std::copy_n(nextByte, part.size(), part.data());
+		nextByte += part.size();
+		return true;
+	});
 }
 
-void LargePacketTransferService::split(Message& message, LargeMessageTransactionId largeMessageTransactionIdentifier) {
-	//TODO: Should this be uint32?
-	uint16_t size = message.dataSize;
-	uint16_t positionCounter = 0;
-	uint16_t parts = (size / ECSSMaxFixedOctetStringSize) + 1;
-	String<ECSSMaxFixedOctetStringSize> stringPart("");
-	uint8_t dataPart[ECSSMaxFixedOctetStringSize];
-
-	for (uint16_t i = 0; i < ECSSMaxFixedOctetStringSize; i++) {
-		dataPart[i] = message.data[positionCounter];
-		positionCounter++;
+bool LargePacketTransferService::splitFile(const Filesystem::Path& path,
+                                           LargeMessageTransactionId largeMessageTransactionIdentifier) {
+	auto attributes = Filesystem::getFileAttributes(path);
+	if (attributes.is_error()) {
+		return false;
 	}
-	stringPart = dataPart;
-	firstDownlinkPartReport(largeMessageTransactionIdentifier, 0, stringPart);
 
-	for (uint16_t part = 1; part < (parts - 1U); part++) {
-		for (uint16_t i = 0; i < ECSSMaxFixedOctetStringSize; i++) {
-			dataPart[i] = message.data[positionCounter];
-			positionCounter++;
-		}
-		stringPart = dataPart;
-		intermediateDownlinkPartReport(largeMessageTransactionIdentifier, part, stringPart);
+	size_t offset = 0;
+	return splitPayload(largeMessageTransactionIdentifier, attributes.value().sizeInBytes,
+	                    [&path, &offset](etl::span<uint8_t> part) {
+		                    auto bytesRead = Filesystem::readFile(path, offset, part);
+		                    if (bytesRead.is_error() or bytesRead.value() != part.size()) {
+			                    return false;
+		                    }
+		                    offset += part.size();
+		                    return true;
+	                    });
+}
+
+bool LargePacketTransferService::splitPacketStore(const PacketStore& packetStore,
+                                                  LargeMessageTransactionId largeMessageTransactionIdentifier) {
+	// The time-tag, service type, message type and data length that precede the data of every stored packet
+	constexpr size_t HeaderSize = sizeof(uint32_t) + sizeof(ServiceTypeNum) + sizeof(MessageTypeNum) + sizeof(uint16_t);
+	const auto& packets = packetStore.storedTelemetryPackets;
+
+	size_t payloadSize = 0;
+	for (const auto& packet: packets) {
+		payloadSize += HeaderSize + packet.second.dataSize;
 	}
 
-	for (uint16_t i = 0; i < ECSSMaxFixedOctetStringSize; i++) {
-		if (message.dataSize == positionCounter) {
-			dataPart[i] = 0; // To prevent from filling the rest of the String with garbage info
+	auto packet = packets.begin();
+	size_t position = 0;
+	return splitPayload(largeMessageTransactionIdentifier, payloadSize, [&packet, &position](etl::span<uint8_t> part) {
+		size_t filled = 0;
+		while (filled < part.size()) {
+			const uint32_t timeTag = packet->first;
+			const Message& message = packet->second;
+			size_t bytes = 0;
+			if (position < HeaderSize) {
+				const uint8_t header[HeaderSize] = {
+				    static_cast<uint8_t>(timeTag >> 24U), static_cast<uint8_t>(timeTag >> 16U),
+				    static_cast<uint8_t>(timeTag >> 8U), static_cast<uint8_t>(timeTag),
+				    message.serviceType, message.messageType,
+				    static_cast<uint8_t>(message.dataSize >> 8U), static_cast<uint8_t>(message.dataSize)};
+				bytes = std::min(HeaderSize - position, part.size() - filled);
+				std::copy_n(header + position, bytes, part.data() + filled);
+			} else {
+				bytes = std::min(HeaderSize + message.dataSize - position, part.size() - filled);
+				std::copy_n(message.data + position - HeaderSize, bytes, part.data() + filled);
+			}
+			filled += bytes;
+			position += bytes;
+
+			if (position == HeaderSize + message.dataSize) {
+				++packet;
+				position = 0;
+			}
 		}
-		dataPart[i] = message.data[positionCounter];
-		positionCounter++;
+		return true;
+	});
+}
+
+void LargePacketTransferService::receiveUplinkPart(Message& message, Reassembler::PartType partType) {
+	auto largeMessageTransactionIdentifier = message.read<LargeMessageTransactionId>();
+	auto partSequenceNumber = message.read<PartSequenceNum>();
+	uint16_t partSize = message.readUint16();
+	if (not ErrorHandler::assertRequest(message.readPosition + partSize <= message.dataSize, message,
+	                                    ErrorHandler::MessageTooShort)) {
+		return;
+	}
+	etl::span<const uint8_t> part(message.data + message.readPosition, partSize);
+	message.skipBytes(partSize);
+
+	const Time::DefaultCUC now = TimeGetter::getCurrentTimeDefaultCUC();
+	reassembler.expire(now, ECSSLargePacketReassemblyTimeout);
+
+	bool packetAccepted = true;
+	auto result = reassembler.receivePart(largeMessageTransactionIdentifier, partSequenceNumber, partType, part, now,
+	                                      [this, &packetAccepted](LargeMessageTransactionId identifier, etl::span<const uint8_t> packet) {
+		                                      packetAccepted = largePacketReassembled(identifier, packet);
+	                                      });
+
+	switch (result) {
+		case Reassembler::PartResult::Completed:
+			if (not packetAccepted) {
+				ErrorHandler::reportError(message, ErrorHandler::ExecutionCompletionErrorType::LargePacketNotAccepted);
+			}
+			break;
+		case Reassembler::PartResult::InvalidPart:
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::InvalidLargePacketPart);
+			break;
+		case Reassembler::PartResult::NoFreeTransaction:
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::MaxLargePacketTransactionsReached);
+			break;
+		default:
+			// Repeated parts are ignored, since a part may be uplinked again when its acknowledgement is lost
+			break;
+	}
+}
+
+void LargePacketTransferService::firstUplinkPart(Message& message) {
+	message.assertTC(ServiceType, FirstUplinkPart);
+	receiveUplinkPart(message, Reassembler::PartType::First);
+}
+
+void LargePacketTransferService::intermediateUplinkPart(Message& message) {
+	message.assertTC(ServiceType, IntermediateUplinkPart);
+	receiveUplinkPart(message, Reassembler::PartType::Intermediate);
+}
+
+void LargePacketTransferService::lastUplinkPart(Message& message) {
+	message.assertTC(ServiceType, LastUplinkPart);
+	receiveUplinkPart(message, Reassembler::PartType::Last);
+}
+
+size_t LargePacketTransferService::expireUplinkTransactions() {
+	return reassembler.expire(TimeGetter::getCurrentTimeDefaultCUC(), ECSSLargePacketReassemblyTimeout);
+}
+
+void LargePacketTransferService::execute(Message& message) {
+	switch (message.messageType) {
+		case FirstUplinkPart:
+			firstUplinkPart(message);
+			break;
+		case IntermediateUplinkPart:
+			intermediateUplinkPart(message);
+			break;
+		case LastUplinkPart:
+			lastUplinkPart(message);
+			break;
+		default:
+			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
-	stringPart = dataPart;
-	lastDownlinkPartReport(largeMessageTransactionIdentifier, (parts - 1U), stringPart);
 }
 
 #endif
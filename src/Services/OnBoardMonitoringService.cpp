@@ -2,6 +2,8 @@
 #ifdef SERVICE_ONBOARDMONITORING
 #include "Message.hpp"
 #include "Services/OnBoardMonitoringService.hpp"
+#include <limits>
+#include "ServicePool.hpp"
 #include "etl/map.h"
 
 void OnBoardMonitoringService::enableParameterMonitoringDefinitions(Message& message) {
@@ -18,8 +20,13 @@ void OnBoardMonitoringService::enableParameterMonitoringDefinitions(Message& mes
 			    message, ErrorHandler::ExecutionStartErrorType::GetNonExistingParameterMonitoringDefinition);
 			continue;
 		}
-		definition->second.get().repetitionNumber = 0;
-		definition->second.get().monitoringEnabled = true;
+		PMONBase& enabledDefinition = getPMONBase(definition->second);
+		enabledDefinition.repetitionCounter = 0;
+		enabledDefinition.pendingCheckingStatus = PMONBase::Unchecked;
+		if (enabledDefinition.checkType == PMONBase::DeltaCheck) {
+			static_cast<PMONDeltaCheck&>(enabledDefinition).resetDeltaHistory();
+		}
+		enabledDefinition.monitoringEnabled = true;
 	}
 }
 
@@ -37,8 +44,9 @@ void OnBoardMonitoringService::disableParameterMonitoringDefinitions(Message& me
 			    message, ErrorHandler::ExecutionStartErrorType::GetNonExistingParameterMonitoringDefinition);
 			continue;
 		}
-		definition->second.get().monitoringEnabled = false;
-		definition->second.get().checkingStatus = PMONBase::Unchecked;
+		PMONBase& disabledDefinition = getPMONBase(definition->second);
+		disabledDefinition.monitoringEnabled = false;
+		disabledDefinition.resetCheckingStatus();
 	}
 }
 
@@ -59,6 +67,445 @@ void OnBoardMonitoringService::deleteAllParameterMonitoringDefinitions(Message&
 		return;
 	}
 	parameterMonitoringList.clear();
+	limitCheckBatchOutdated = true;
+}
+
+etl::optional<PMONVariant> OnBoardMonitoringService::readPMONDefinition(Message& message,
+                                                                        ParameterId monitoredParameterId,
+                                                                        uint16_t repetitionNumber,
+                                                                        PMONBase::CheckType checkType) {
+	etl::optional<PMONVariant> definition;
+	const bool parameterExists = Services.parameterManagement.getParameter(monitoredParameterId).has_value();
+	auto eventExists = [&message](EventDefinitionId eventDefinitionId) {
+		if (eventDefinitionId >= EventReportService::numberOfEvents) {
+			ErrorHandler::reportError(message, ErrorHandler::InvalidParameterMonitoringEventDefinition);
+			return false;
+		}
+		return true;
+	};
+
+	switch (checkType) {
+		case PMONBase::ExpectedValueCheck: {
+			const uint64_t mask = message.readUint64();
+			const float expectedValue = message.readFloat();
+			const EventDefinitionId unexpectedValueEvent = message.read<EventDefinitionId>();
+			if (not eventExists(unexpectedValueEvent)) {
+				return {};
+			}
+			if (parameterExists) {
+				definition.emplace(PMONExpectedValueCheck(monitoredParameterId, repetitionNumber, expectedValue, mask,
+				                                          unexpectedValueEvent));
+			}
+			break;
+		}
+		case PMONBase::LimitCheck: {
+			const float lowLimit = message.readFloat();
+			const EventDefinitionId belowLowLimitEvent = message.read<EventDefinitionId>();
+			const float highLimit = message.readFloat();
+			const EventDefinitionId aboveHighLimitEvent = message.read<EventDefinitionId>();
+			if (highLimit < lowLimit) {
+				ErrorHandler::reportError(message, ErrorHandler::HighLimitIsLowerThanLowLimit);
+				return {};
+			}
+			if (not eventExists(belowLowLimitEvent) or not eventExists(aboveHighLimitEvent)) {
+				return {};
+			}
+			if (parameterExists) {
+				definition.emplace(PMONLimitCheck(monitoredParameterId, repetitionNumber, lowLimit, belowLowLimitEvent,
+				                                  highLimit, aboveHighLimitEvent));
+			}
+			break;
+		}
+		case PMONBase::DeltaCheck: {
+			const uint16_t numberOfConsecutiveDeltaChecks = message.readUint16();
+			const float lowDeltaThreshold = message.readFloat();
+			const EventDefinitionId belowLowThresholdEvent = message.read<EventDefinitionId>();
+			const float highDeltaThreshold = message.readFloat();
+			const EventDefinitionId aboveHighThresholdEvent = message.read<EventDefinitionId>();
+			if (highDeltaThreshold < lowDeltaThreshold) {
+				ErrorHandler::reportError(message, ErrorHandler::HighThresholdIsLowerThanLowThreshold);
+				return {};
+			}
+			if (not eventExists(belowLowThresholdEvent) or not eventExists(aboveHighThresholdEvent)) {
+				return {};
+			}
+			if (parameterExists) {
+				definition.emplace(PMONDeltaCheck(monitoredParameterId, repetitionNumber,
+				                                  numberOfConsecutiveDeltaChecks, lowDeltaThreshold,
+				                                  belowLowThresholdEvent, highDeltaThreshold, aboveHighThresholdEvent));
+			}
+			break;
+		}
+	}
+
+	if (not parameterExists) {
+		ErrorHandler::reportError(message, ErrorHandler::GetNonExistingParameter);
+	}
+	return definition;
+}
+
+void OnBoardMonitoringService::addParameterMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, AddParameterMonitoringDefinitions)) {
+		return;
+	}
+
+	uint16_t numberOfPMONDefinitions = message.readUint16();
+	for (uint16_t i = 0; i < numberOfPMONDefinitions; i++) {
+		const PMONId currentId = message.read<PMONId>();
+		const ParameterId monitoredParameterId = message.read<ParameterId>();
+		const uint32_t monitoringInterval = message.readUint32();
+		const uint16_t repetitionNumber = message.readUint16();
+		const uint8_t checkType = message.readUint8();
+		if (checkType > PMONBase::DeltaCheck) {
+			// The rest of the request cannot be parsed
+			ErrorHandler::reportError(message, ErrorHandler::InvalidParameterMonitoringCheckType);
+			return;
+		}
+
+		auto definition = readPMONDefinition(message, monitoredParameterId, repetitionNumber,
+		                                     static_cast<PMONBase::CheckType>(checkType));
+		if (not definition) {
+			continue;
+		}
+		if (parameterMonitoringList.find(currentId) != parameterMonitoringList.end()) {
+			ErrorHandler::reportError(message, ErrorHandler::AddAlreadyExistingParameter);
+			continue;
+		}
+		if (parameterMonitoringList.full()) {
+			ErrorHandler::reportError(message, ErrorHandler::ParameterMonitoringListIsFull);
+			continue;
+		}
+
+		getPMONBase(*definition).monitoringInterval = monitoringInterval;
+		parameterMonitoringList.insert({currentId, *definition});
+		limitCheckBatchOutdated = true;
+	}
+}
+
+void OnBoardMonitoringService::deleteParameterMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, DeleteParameterMonitoringDefinitions)) {
+		return;
+	}
+
+	uint16_t numberOfPMONDefinitions = message.readUint16();
+	for (uint16_t i = 0; i < numberOfPMONDefinitions; i++) {
+		PMONId currentId = message.read<PMONId>();
+		auto definition = parameterMonitoringList.find(currentId);
+		if (definition == parameterMonitoringList.end()) {
+			ErrorHandler::reportError(message, ErrorHandler::GetNonExistingParameterMonitoringDefinition);
+			continue;
+		}
+		if (getPMONBase(definition->second).monitoringEnabled) {
+			ErrorHandler::reportError(message, ErrorHandler::InvalidRequestToDeleteParameterMonitoringDefinition);
+			continue;
+		}
+		parameterMonitoringList.erase(definition);
+		limitCheckBatchOutdated = true;
+	}
+}
+
+void OnBoardMonitoringService::modifyParameterMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, ModifyParameterMonitoringDefinitions)) {
+		return;
+	}
+
+	uint16_t numberOfPMONDefinitions = message.readUint16();
+	for (uint16_t i = 0; i < numberOfPMONDefinitions; i++) {
+		const PMONId currentId = message.read<PMONId>();
+		const ParameterId monitoredParameterId = message.read<ParameterId>();
+		const uint32_t monitoringInterval = message.readUint32();
+		const uint16_t repetitionNumber = message.readUint16();
+		const uint8_t checkType = message.readUint8();
+		if (checkType > PMONBase::DeltaCheck) {
+			ErrorHandler::reportError(message, ErrorHandler::InvalidParameterMonitoringCheckType);
+			return;
+		}
+
+		auto newDefinition = readPMONDefinition(message, monitoredParameterId, repetitionNumber,
+		                                        static_cast<PMONBase::CheckType>(checkType));
+		if (not newDefinition) {
+			continue;
+		}
+		auto definition = parameterMonitoringList.find(currentId);
+		if (definition == parameterMonitoringList.end()) {
+			ErrorHandler::reportError(message, ErrorHandler::ModifyParameterNotInTheParameterMonitoringList);
+			continue;
+		}
+		PMONBase& currentDefinition = getPMONBase(definition->second);
+		if (currentDefinition.monitoredParameterId != monitoredParameterId) {
+			ErrorHandler::reportError(message,
+			                          ErrorHandler::DifferentParameterMonitoringDefinitionAndMonitoredParameter);
+			continue;
+		}
+
+		PMONBase& modifiedDefinition = getPMONBase(*newDefinition);
+		modifiedDefinition.monitoringEnabled = currentDefinition.monitoringEnabled;
+		modifiedDefinition.monitoringInterval = monitoringInterval;
+		definition->second = *newDefinition;
+		limitCheckBatchOutdated = true;
+	}
+}
+
+void OnBoardMonitoringService::reportParameterMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, ReportParameterMonitoringDefinitions)) {
+		return;
+	}
+
+	etl::vector<PMONId, ECSSMaxMonitoringDefinitions> reportedIds;
+	uint16_t numberOfPMONDefinitions = message.readUint16();
+	for (uint16_t i = 0; i < numberOfPMONDefinitions; i++) {
+		PMONId currentId = message.read<PMONId>();
+		if (parameterMonitoringList.find(currentId) == parameterMonitoringList.end()) {
+			ErrorHandler::reportError(message, ErrorHandler::ReportParameterNotInTheParameterMonitoringList);
+			continue;
+		}
+		if (not reportedIds.full()) {
+			reportedIds.push_back(currentId);
+		}
+	}
+
+	Message report = createTM(ParameterMonitoringDefinitionReport);
+	report.appendUint16(maximumTransitionReportingDelay);
+	report.appendUint16(reportedIds.size());
+	for (PMONId id: reportedIds) {
+		appendPMONDefinition(report, id, parameterMonitoringList.at(id));
+	}
+	storeMessage(report);
+}
+
+void OnBoardMonitoringService::appendPMONDefinition(Message& report, PMONId id, PMONVariant& PMONDefinition) {
+	const PMONBase& definition = getPMONBase(PMONDefinition);
+	report.append<PMONId>(id);
+	report.append<ParameterId>(definition.monitoredParameterId);
+	report.appendBoolean(definition.monitoringEnabled);
+	report.appendUint32(definition.monitoringInterval);
+	report.appendUint16(definition.repetitionNumber);
+	report.appendUint8(definition.checkType);
+
+	switch (definition.checkType) {
+		case PMONBase::ExpectedValueCheck: {
+			const auto& expectedValueCheck = static_cast<const PMONExpectedValueCheck&>(definition);
+			report.appendUint64(expectedValueCheck.mask);
+			report.appendFloat(static_cast<float>(expectedValueCheck.expectedValue));
+			report.append<EventDefinitionId>(expectedValueCheck.unexpectedValueEvent);
+			break;
+		}
+		case PMONBase::LimitCheck: {
+			const auto& limitCheck = static_cast<const PMONLimitCheck&>(definition);
+			report.appendFloat(static_cast<float>(limitCheck.lowLimit));
+			report.append<EventDefinitionId>(limitCheck.belowLowLimitEvent);
+			report.appendFloat(static_cast<float>(limitCheck.highLimit));
+			report.append<EventDefinitionId>(limitCheck.aboveHighLimitEvent);
+			break;
+		}
+		case PMONBase::DeltaCheck: {
+			const auto& deltaCheck = static_cast<const PMONDeltaCheck&>(definition);
+			report.appendUint16(deltaCheck.numberOfConsecutiveDeltaChecks);
+			report.appendFloat(static_cast<float>(deltaCheck.lowDeltaThreshold));
+			report.append<EventDefinitionId>(deltaCheck.belowLowThresholdEvent);
+			report.appendFloat(static_cast<float>(deltaCheck.highDeltaThreshold));
+			report.append<EventDefinitionId>(deltaCheck.aboveHighThresholdEvent);
+			break;
+		}
+	}
+}
+
+bool OnBoardMonitoringService::checkParameterMonitoringDefinition(PMONId PMONId, PMONBase& PMONDefinition,
+                                                                  TimeStamps currentTime) {
+	const double value = PMONDefinition.monitoredParameter.get().getValueAsDouble();
+
+	PMONBase::CheckingStatus checkResult = PMONBase::Unchecked;
+	switch (PMONDefinition.checkType) {
+		case PMONBase::ExpectedValueCheck:
+			checkResult = static_cast<PMONExpectedValueCheck&>(PMONDefinition).checkValue(value);
+			break;
+		case PMONBase::LimitCheck:
+			checkResult = static_cast<PMONLimitCheck&>(PMONDefinition).checkValue(value);
+			break;
+		case PMONBase::DeltaCheck:
+			checkResult = static_cast<PMONDeltaCheck&>(PMONDefinition).checkValue(value);
+			break;
+	}
+
+	return applyCheckResult(PMONId, PMONDefinition, checkResult, value, currentTime);
+}
+
+bool OnBoardMonitoringService::applyCheckResult(PMONId PMONId, PMONBase& PMONDefinition,
+                                                PMONBase::CheckingStatus checkResult, double checkedValue,
+                                                TimeStamps currentTime) {
+	if (not PMONDefinition.updateCheckingStatus(checkResult)) {
+		return false;
+	}
+
+	recordCheckTransition(PMONId, PMONDefinition, checkedValue, currentTime);
+	raiseCheckTransitionEvent(PMONId, PMONDefinition);
+	return true;
+}
+
+void OnBoardMonitoringService::recordCheckTransition(PMONId PMONId, const PMONBase& PMONDefinition,
+                                                     double checkedValue, TimeStamps currentTime) {
+	double limitCrossed = 0;
+	switch (PMONDefinition.checkingStatus) {
+		case PMONBase::ExpectedValue:
+		case PMONBase::UnexpectedValue:
+			limitCrossed = static_cast<const PMONExpectedValueCheck&>(PMONDefinition).expectedValue;
+			break;
+		case PMONBase::BelowLowLimit:
+			limitCrossed = static_cast<const PMONLimitCheck&>(PMONDefinition).lowLimit;
+			break;
+		case PMONBase::AboveHighLimit:
+			limitCrossed = static_cast<const PMONLimitCheck&>(PMONDefinition).highLimit;
+			break;
+		case PMONBase::BelowLowThreshold:
+			limitCrossed = static_cast<const PMONDeltaCheck&>(PMONDefinition).lowDeltaThreshold;
+			break;
+		case PMONBase::AboveHighThreshold:
+			limitCrossed = static_cast<const PMONDeltaCheck&>(PMONDefinition).highDeltaThreshold;
+			break;
+		default:
+			break;
+	}
+
+	if (checkTransitionBuffer.empty()) {
+		checkTransitionReportDeadline =
+		    currentTime + static_cast<TimeStamps>(maximumTransitionReportingDelay) * ECSSMinimumSamplingIntervalMs;
+	}
+
+	checkTransitionBuffer.push_back({PMONId, PMONDefinition.monitoredParameterId, PMONDefinition.checkType,
+	                                 limitCrossed, checkedValue, PMONDefinition.checkTransitionList[0],
+	                                 PMONDefinition.checkTransitionList[1], TimeGetter::getCurrentTimeDefaultCUC()});
+	checkTransitionHighWaterMark =
+	    std::max(checkTransitionHighWaterMark, static_cast<uint16_t>(checkTransitionBuffer.size()));
+
+	if (checkTransitionBuffer.full()) {
+		checkTransitionReport();
+	}
+}
+
+void OnBoardMonitoringService::checkTransitionReport() {
+	Message report = createTM(CheckTransitionReport);
+	report.appendUint16(checkTransitionBuffer.size());
+	for (const auto& transition: checkTransitionBuffer) {
+		report.append<PMONId>(transition.id);
+		report.append<ParameterId>(transition.monitoredParameterId);
+		report.appendUint8(transition.checkType);
+		report.appendFloat(static_cast<float>(transition.limitCrossed));
+		report.appendFloat(static_cast<float>(transition.parameterValue));
+		report.appendUint8(transition.previousStatus);
+		report.appendUint8(transition.currentStatus);
+		report.append(transition.transitionTime);
+	}
+	storeMessage(report);
+
+	checkTransitionBuffer.clear();
+}
+
+void OnBoardMonitoringService::raiseCheckTransitionEvent(PMONId PMONId, const PMONBase& PMONDefinition) {
+#ifdef SERVICE_EVENTREPORT
+	uint16_t eventId = 0;
+	switch (PMONDefinition.checkingStatus) {
+		case PMONBase::UnexpectedValue:
+			eventId = static_cast<const PMONExpectedValueCheck&>(PMONDefinition).unexpectedValueEvent;
+			break;
+		case PMONBase::BelowLowLimit:
+			eventId = static_cast<const PMONLimitCheck&>(PMONDefinition).belowLowLimitEvent;
+			break;
+		case PMONBase::AboveHighLimit:
+			eventId = static_cast<const PMONLimitCheck&>(PMONDefinition).aboveHighLimitEvent;
+			break;
+		case PMONBase::BelowLowThreshold:
+			eventId = static_cast<const PMONDeltaCheck&>(PMONDefinition).belowLowThresholdEvent;
+			break;
+		case PMONBase::AboveHighThreshold:
+			eventId = static_cast<const PMONDeltaCheck&>(PMONDefinition).aboveHighThresholdEvent;
+			break;
+		default:
+			// Transitions back to a nominal status do not raise an event
+			return;
+	}
+
+	const uint8_t auxiliaryData[] = {static_cast<uint8_t>(PMONId >> 8), static_cast<uint8_t>(PMONId & 0xFF),
+	                                 static_cast<uint8_t>(PMONDefinition.checkingStatus)};
+	Services.eventReport.eventReport(static_cast<EventReportService::Event>(eventId),
+	                                 String<ECSSEventDataAuxiliaryMaxSize>(auxiliaryData, 3));
+#endif
+}
+
+void OnBoardMonitoringService::rebuildLimitCheckBatch() {
+	limitCheckBatch.clear();
+	for (auto& entry: parameterMonitoringList) {
+		PMONBase& definition = getPMONBase(entry.second);
+		if (definition.checkType != PMONBase::LimitCheck) {
+			continue;
+		}
+		const auto& limitCheck = static_cast<const PMONLimitCheck&>(definition);
+		const size_t slot = limitCheckBatch.add(limitCheck.lowLimit, limitCheck.highLimit,
+		                                        definition.monitoredParameter.get());
+		limitCheckBatchDefinitions[slot] = {entry.first, &definition};
+	}
+	limitCheckBatchOutdated = false;
+}
+
+TimeStamps OnBoardMonitoringService::checkPendingDefinitions(TimeStamps currentTime) {
+	TimeStamps nextWakeUp = std::numeric_limits<TimeStamps>::max();
+
+	if (not parameterMonitoringFunctionStatus) {
+		return nextWakeUp;
+	}
+
+	if (limitCheckBatchOutdated) {
+		rebuildLimitCheckBatch();
+	}
+
+	// The slots of the limit checks follow the order of the parameter monitoring list
+	size_t limitCheckSlot = 0;
+	for (auto& entry: parameterMonitoringList) {
+		PMONBase& definition = getPMONBase(entry.second);
+		const bool isLimitCheck = definition.checkType == PMONBase::LimitCheck;
+		const size_t slot = isLimitCheck ? limitCheckSlot++ : 0;
+		if (not definition.monitoringEnabled) {
+			continue;
+		}
+
+		const bool isDue = definition.monitoringInterval == 0 or currentTime >= definition.nextCheckTime;
+		if (isDue) {
+			if (isLimitCheck) {
+				limitCheckBatch.setDue(slot, definition.checkingStatus, definition.repetitionCounter != 0);
+			} else {
+				checkParameterMonitoringDefinition(entry.first, definition, currentTime);
+			}
+		}
+
+		if (definition.monitoringInterval == 0) {
+			continue;
+		}
+
+		if (isDue) {
+			definition.nextCheckTime += definition.monitoringInterval;
+			if (definition.nextCheckTime <= currentTime) {
+				// Missed checks are skipped, instead of being performed in a burst
+				definition.nextCheckTime = currentTime + definition.monitoringInterval;
+			}
+		}
+		nextWakeUp = std::min(nextWakeUp, definition.nextCheckTime - currentTime);
+	}
+
+	if (limitCheckBatch.evaluate() != 0) {
+		limitCheckBatch.forEachMarkedSlot([this, currentTime](size_t slot, PMONBase::CheckingStatus checkResult) {
+			const BatchedLimitCheck& batchedLimitCheck = limitCheckBatchDefinitions[slot];
+			applyCheckResult(batchedLimitCheck.id, *batchedLimitCheck.definition, checkResult,
+			                 limitCheckBatch.getValue(slot), currentTime);
+		});
+	}
+
+	if (checkTransitionBuffer.empty()) {
+		return nextWakeUp;
+	}
+	if (currentTime >= checkTransitionReportDeadline) {
+		checkTransitionReport();
+		return nextWakeUp;
+	}
+	return std::min(nextWakeUp, checkTransitionReportDeadline - currentTime);
 }
 
 void OnBoardMonitoringService::execute(Message& message) {
@@ -75,6 +522,18 @@ void OnBoardMonitoringService::execute(Message& message) {
 		case DeleteAllParameterMonitoringDefinitions:
 			deleteAllParameterMonitoringDefinitions(message);
 			break;
+		case AddParameterMonitoringDefinitions:
+			addParameterMonitoringDefinitions(message);
+			break;
+		case DeleteParameterMonitoringDefinitions:
+			deleteParameterMonitoringDefinitions(message);
+			break;
+		case ModifyParameterMonitoringDefinitions:
+			modifyParameterMonitoringDefinitions(message);
+			break;
+		case ReportParameterMonitoringDefinitions:
+			reportParameterMonitoringDefinitions(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
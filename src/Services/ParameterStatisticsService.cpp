@@ -1,5 +1,6 @@
 #include "ECSS_Configuration.hpp"
 #ifdef SERVICE_PARAMETER
+#include <limits>
 #include "ServicePool.hpp"
 #include "Services/ParameterStatisticsService.hpp"
 
@@ -52,6 +53,9 @@ void ParameterStatisticsService::parameterStatisticsReport() {
 		report.append<ParameterId>(currentId);
 		report.append<ParameterSampleCount>(numOfSamples);
 		currentStatistic.second.appendStatisticsToMessage(report);
+		if (supportsStatisticsAccumulators) {
+			currentStatistic.second.appendAccumulatorsToMessage(report);
+		}
 	}
 	storeMessage(report);
 }
@@ -86,6 +90,8 @@ void ParameterStatisticsService::enablePeriodicStatisticsReporting(Message& requ
 
 	periodicStatisticsReportingStatus = true;
 	reportingIntervalMs = timeInterval;
+	reportingTimeIsOutdated = true;
+	samplingGroupsAreOutdated = true;
 }
 
 void ParameterStatisticsService::disablePeriodicStatisticsReporting(Message& request) {
@@ -95,6 +101,7 @@ void ParameterStatisticsService::disablePeriodicStatisticsReporting(Message& req
 
 	periodicStatisticsReportingStatus = false;
 	reportingIntervalMs = 0;
+	samplingGroupsAreOutdated = true;
 }
 
 void ParameterStatisticsService::addOrUpdateStatisticsDefinitions(Message& request) {
@@ -110,16 +117,35 @@ void ParameterStatisticsService::addOrUpdateStatisticsDefinitions(Message& reque
 			if (supportsSamplingInterval) {
 				request.skipBytes(sizeof(SamplingInterval));
 			}
+			if (supportsStatisticsAccumulators) {
+				request.skipBytes(sizeof(uint8_t) + 2 * sizeof(float));
+			}
 			continue;
 		}
 		bool exists = statisticsMap.find(currentId) != statisticsMap.end();
 		SamplingInterval interval = 0;
 		if (supportsSamplingInterval) {
 			interval = request.read<SamplingInterval>();
-			if (interval < reportingIntervalMs) {
-				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::InvalidSamplingRateError);
-				continue;
-			}
+		}
+		uint8_t windowSize = 0;
+		float histogramLowLimit = 0;
+		float histogramHighLimit = 0;
+		if (supportsStatisticsAccumulators) {
+			windowSize = request.readUint8();
+			histogramLowLimit = request.readFloat();
+			histogramHighLimit = request.readFloat();
+		}
+		if (supportsSamplingInterval and interval < reportingIntervalMs) {
+			ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::InvalidSamplingRateError);
+			continue;
+		}
+		if (windowSize > ECSSMaxStatisticWindowSize) {
+			ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::InvalidStatisticWindowSize);
+			continue;
+		}
+		if (histogramHighLimit < histogramLowLimit) {
+			ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::InvalidStatisticHistogramRange);
+			continue;
 		}
 		if (not exists) {
 			if (statisticsMap.size() >= ECSSMaxStatisticParameters) {
@@ -131,14 +157,23 @@ void ParameterStatisticsService::addOrUpdateStatisticsDefinitions(Message& reque
 			if (supportsSamplingInterval) {
 				newStatistic.setSelfSamplingInterval(interval);
 			}
+			if (supportsStatisticsAccumulators) {
+				newStatistic.window.setSize(windowSize);
+				newStatistic.histogram.setRange(histogramLowLimit, histogramHighLimit);
+			}
 			statisticsMap.insert({currentId, newStatistic});
-			// TODO: start the evaluation of statistics for this parameter.
 		} else {
+			Statistic& statistic = statisticsMap.at(currentId);
 			if (supportsSamplingInterval) {
-				statisticsMap.at(currentId).setSelfSamplingInterval(interval);
+				statistic.setSelfSamplingInterval(interval);
 			}
-			statisticsMap.at(currentId).resetStatistics();
+			if (supportsStatisticsAccumulators) {
+				statistic.window.setSize(windowSize);
+				statistic.histogram.setRange(histogramLowLimit, histogramHighLimit);
+			}
+			statistic.resetStatistics();
 		}
+		samplingGroupsAreOutdated = true;
 	}
 }
 
@@ -151,6 +186,7 @@ void ParameterStatisticsService::deleteStatisticsDefinitions(Message& request) {
 	if (numOfIds == 0) {
 		statisticsMap.clear();
 		periodicStatisticsReportingStatus = false;
+		samplingGroupsAreOutdated = true;
 		return;
 	}
 	for (uint16_t i = 0; i < numOfIds; i++) {
@@ -164,6 +200,7 @@ void ParameterStatisticsService::deleteStatisticsDefinitions(Message& request) {
 	if (statisticsMap.empty()) {
 		periodicStatisticsReportingStatus = false;
 	}
+	samplingGroupsAreOutdated = true;
 }
 
 void ParameterStatisticsService::reportStatisticsDefinitions(Message& request) {
@@ -190,10 +227,124 @@ void ParameterStatisticsService::statisticsDefinitionsReport() {
 		if (supportsSamplingInterval) {
 			definitionsReport.append<SamplingInterval>(samplingInterval);
 		}
+		if (supportsStatisticsAccumulators) {
+			definitionsReport.appendUint8(currentParam.second.window.getSize());
+			definitionsReport.appendFloat(static_cast<float>(currentParam.second.histogram.getLowLimit()));
+			definitionsReport.appendFloat(static_cast<float>(currentParam.second.histogram.getHighLimit()));
+		}
 	}
 	storeMessage(definitionsReport);
 }
 
+SamplingInterval ParameterStatisticsService::getEffectiveSamplingInterval(const Statistic& statistic) const {
+	if (supportsSamplingInterval and statistic.selfSamplingInterval != 0) {
+		return statistic.selfSamplingInterval;
+	}
+	return reportingIntervalMs;
+}
+
+ParameterStatisticsService::SamplingGroup* ParameterStatisticsService::findSamplingGroup(SamplingInterval samplingInterval) {
+	for (auto& group: samplingGroups) {
+		if (group.samplingInterval == samplingInterval) {
+			return &group;
+		}
+	}
+	return nullptr;
+}
+
+void ParameterStatisticsService::updateSamplingGroups(TimeStamps currentTime) {
+	etl::vector<SamplingGroup, ECSSMaxStatisticParameters> previousGroups = samplingGroups;
+	samplingGroups.clear();
+
+	for (auto& statistic: statisticsMap) {
+		SamplingInterval interval = getEffectiveSamplingInterval(statistic.second);
+		if (findSamplingGroup(interval) != nullptr) {
+			continue;
+		}
+
+		SamplingGroup newGroup;
+		newGroup.samplingInterval = interval;
+		newGroup.nextSamplingTime = currentTime;
+		for (auto& previousGroup: previousGroups) {
+			if (previousGroup.samplingInterval == interval) {
+				newGroup.nextSamplingTime = previousGroup.nextSamplingTime;
+				break;
+			}
+		}
+		samplingGroups.push_back(newGroup);
+	}
+
+	numberOfScheduledStatistics = statisticsMap.size();
+	samplingGroupsAreOutdated = false;
+}
+
+TimeStamps ParameterStatisticsService::samplePendingStatistics(TimeStamps currentTime) {
+	TimeStamps nextWakeUp = std::numeric_limits<TimeStamps>::max();
+
+	if (samplingGroupsAreOutdated or numberOfScheduledStatistics != statisticsMap.size()) {
+		updateSamplingGroups(currentTime);
+	}
+
+	bool anyGroupIsDue = false;
+	for (auto& group: samplingGroups) {
+		if (group.samplingInterval == 0) {
+			group.isDue = true;
+			anyGroupIsDue = true;
+			continue;
+		}
+
+		group.isDue = currentTime >= group.nextSamplingTime;
+		if (group.isDue) {
+			anyGroupIsDue = true;
+			group.nextSamplingTime += group.samplingInterval;
+			if (group.nextSamplingTime <= currentTime) {
+				// Missed samples are skipped, instead of being taken in a burst
+				group.nextSamplingTime = currentTime + group.samplingInterval;
+			}
+		}
+		nextWakeUp = std::min(nextWakeUp, group.nextSamplingTime - currentTime);
+	}
+
+	if (anyGroupIsDue) {
+		const Time::DefaultCUC sampleTime = TimeGetter::getCurrentTimeDefaultCUC();
+		for (auto& statistic: statisticsMap) {
+			SamplingGroup* group = findSamplingGroup(getEffectiveSamplingInterval(statistic.second));
+			if (group == nullptr) {
+				// The sampling interval was modified without a TC, so the groups will be rebuilt in the next pass
+				samplingGroupsAreOutdated = true;
+				continue;
+			}
+			if (not group->isDue) {
+				continue;
+			}
+
+			auto parameter = Services.parameterManagement.getParameter(statistic.first);
+			if (not parameter) {
+				continue;
+			}
+			statistic.second.updateStatistics(parameter->get().getValueAsDouble(), sampleTime);
+		}
+	}
+
+	if (not periodicStatisticsReportingStatus or reportingIntervalMs == 0) {
+		return nextWakeUp;
+	}
+
+	if (reportingTimeIsOutdated) {
+		nextReportingTime = currentTime + reportingIntervalMs;
+		reportingTimeIsOutdated = false;
+	}
+	if (currentTime >= nextReportingTime) {
+		reportParameterStatistics(false);
+		nextReportingTime += reportingIntervalMs;
+		if (nextReportingTime <= currentTime) {
+			nextReportingTime = currentTime + reportingIntervalMs;
+		}
+	}
+
+	return std::min(nextWakeUp, nextReportingTime - currentTime);
+}
+
 void ParameterStatisticsService::execute(Message& message) {
 	DefaultTimestamp currentTime;
 	switch (message.messageType) {
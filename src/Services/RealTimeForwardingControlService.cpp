@@ -2,18 +2,19 @@
 #ifdef SERVICE_REALTIMEFORWARDINGCONTROL
 
 #include "Services/RealTimeForwardingControlService.hpp"
+#include "Services/EventReportService.hpp"
+#include "Services/HousekeepingService.hpp"
 
 void RealTimeForwardingControlService::addAllReportsOfApplication(ApplicationProcessId applicationID) {
-	for (const auto& service: AllReportTypes::MessagesOfService) {
-		uint8_t serviceType = service.first;
+	AllReportTypes::MessagesOfService.forEachService([this, applicationID](ServiceTypeNum serviceType) {
 		addAllReportsOfService(applicationID, serviceType);
-	}
+	});
 }
 
 void RealTimeForwardingControlService::addAllReportsOfService(ApplicationProcessId applicationID, ServiceTypeNum serviceType) {
-	for (const auto& messageType: AllReportTypes::MessagesOfService.at(serviceType)) {
-		auto appServicePair = std::make_pair(applicationID, serviceType);
-		applicationProcessConfiguration.definitions[appServicePair].push_back(messageType);
+	auto& definition = applicationProcessConfiguration.definitions[std::make_pair(applicationID, serviceType)];
+	for (const auto messageType: AllReportTypes::MessagesOfService.at(serviceType)) {
+		definition.push_back(messageType);
 	}
 }
 
@@ -145,6 +146,7 @@ void RealTimeForwardingControlService::addReportTypesToAppProcessConfiguration(M
 			}
 		}
 	}
+	rebuildForwardingFilter();
 }
 
 bool RealTimeForwardingControlService::isApplicationEnabled(ApplicationProcessId targetAppID) {
@@ -237,6 +239,7 @@ void RealTimeForwardingControlService::deleteReportTypesFromAppProcessConfigurat
 	uint8_t numOfApplications = request.readUint8();
 	if (numOfApplications == 0) {
 		applicationProcessConfiguration.definitions.clear();
+		rebuildForwardingFilter();
 		return;
 	}
 
@@ -274,6 +277,7 @@ void RealTimeForwardingControlService::deleteReportTypesFromAppProcessConfigurat
 			}
 		}
 	}
+	rebuildForwardingFilter();
 }
 
 void RealTimeForwardingControlService::reportAppProcessConfigurationContent(Message& request) {
@@ -327,6 +331,180 @@ void RealTimeForwardingControlService::appProcessConfigurationContentReport() {
 	storeMessage(report);
 }
 
+bool RealTimeForwardingControlService::forwardReport(const Message& report) {
+	const bool controlled = std::find(controlledApplications.begin(), controlledApplications.end(), report.applicationId) !=
+	                        controlledApplications.end();
+	bool forwarded = not controlled or isReportForwarded(report.applicationId, report.serviceType, report.messageType);
+
+	// The structure and event definition IDs are the first fields of their reports, so they are read in place
+	if (controlled and forwarded and report.serviceType == HousekeepingService::ServiceType and
+	    report.messageType == HousekeepingService::MessageType::HousekeepingParametersReport and report.dataSize >= 1) {
+		forwarded = housekeepingConfiguration.isEnabled(report.applicationId, report.data[0]);
+	}
+	if (controlled and forwarded and report.serviceType == EventReportService::ServiceType and
+	    report.messageType >= EventReportService::MessageType::InformativeEventReport and
+	    report.messageType <= EventReportService::MessageType::HighSeverityAnomalyReport and report.dataSize >= 2) {
+		const auto eventID = static_cast<EventDefinitionId>((report.data[0] << 8U) | report.data[1]);
+		forwarded = eventReportConfiguration.isEnabled(report.applicationId, eventID);
+	}
+
+	const auto reportType = std::make_pair(report.serviceType, report.messageType);
+	auto counters = forwardingCounters.find(reportType);
+	if (counters == forwardingCounters.end() and not forwardingCounters.full()) {
+		counters = forwardingCounters.insert(std::make_pair(reportType, ForwardingCounters())).first;
+	}
+	ForwardingCounters& reportTypeCounters = (counters != forwardingCounters.end()) ? counters->second : uncountedReportTypeCounters;
+
+	if (forwarded) {
+		reportTypeCounters.forwarded++;
+	} else {
+		reportTypeCounters.dropped++;
+	}
+	return forwarded;
+}
+
+RealTimeForwardingControlService::ForwardingCounters RealTimeForwardingControlService::getForwardingCounters(ServiceTypeNum serviceType,
+                                                                                                               MessageTypeNum messageType) const {
+	const auto counters = forwardingCounters.find(std::make_pair(serviceType, messageType));
+	if (counters == forwardingCounters.end()) {
+		return {};
+	}
+	return counters->second;
+}
+
+template <class Configuration>
+void RealTimeForwardingControlService::addIdentifiersToConfiguration(Message& request, Configuration& configuration) {
+	using Identifier = typename Configuration::IdentifierType;
+
+	uint8_t numOfApplications = request.readUint8();
+	for (uint8_t currentApplicationNumber = 0; currentApplicationNumber < numOfApplications; currentApplicationNumber++) {
+		ApplicationProcessId applicationID = request.read<ApplicationProcessId>();
+		uint8_t numOfIdentifiers = request.readUint8();
+
+		if (not checkAppControlled(request, applicationID)) {
+			request.skipBytes(numOfIdentifiers * sizeof(Identifier));
+			continue;
+		}
+		if (numOfIdentifiers == 0) {
+			configuration.addAll(applicationID);
+			continue;
+		}
+
+		for (uint8_t currentIdentifierNumber = 0; currentIdentifierNumber < numOfIdentifiers; currentIdentifierNumber++) {
+			auto identifier = request.read<Identifier>();
+			if (not Configuration::isValid(identifier)) {
+				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::InvalidForwardControlDefinition);
+				continue;
+			}
+			configuration.add(applicationID, identifier);
+		}
+	}
+}
+
+template <class Configuration>
+void RealTimeForwardingControlService::deleteIdentifiersFromConfiguration(Message& request, Configuration& configuration) {
+	using Identifier = typename Configuration::IdentifierType;
+
+	uint8_t numOfApplications = request.readUint8();
+	if (numOfApplications == 0) {
+		configuration.clear();
+		return;
+	}
+
+	for (uint8_t currentApplicationNumber = 0; currentApplicationNumber < numOfApplications; currentApplicationNumber++) {
+		ApplicationProcessId applicationID = request.read<ApplicationProcessId>();
+		uint8_t numOfIdentifiers = request.readUint8();
+
+		if (not configuration.containsApplication(applicationID)) {
+			ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::NonExistentApplicationProcess);
+			request.skipBytes(numOfIdentifiers * sizeof(Identifier));
+			continue;
+		}
+		if (numOfIdentifiers == 0) {
+			configuration.removeApplication(applicationID);
+			continue;
+		}
+
+		for (uint8_t currentIdentifierNumber = 0; currentIdentifierNumber < numOfIdentifiers; currentIdentifierNumber++) {
+			if (not configuration.remove(applicationID, request.read<Identifier>())) {
+				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::NonExistentForwardControlDefinition);
+			}
+		}
+	}
+}
+
+template <class Configuration>
+void RealTimeForwardingControlService::identifierConfigurationContentReport(MessageType messageType, const Configuration& configuration) {
+	using Identifier = typename Configuration::IdentifierType;
+
+	Message report = createTM(messageType);
+	report.appendUint8(configuration.size());
+	configuration.forEachApplication([&report](ApplicationProcessId applicationID, const auto& identifiers) {
+		report.append<ApplicationProcessId>(applicationID);
+		if (identifiers.all()) {
+			report.appendUint8(0);
+			return;
+		}
+		report.appendUint8(identifiers.count());
+		for (size_t identifier = 0; identifier < identifiers.size(); identifier++) {
+			if (identifiers.test(identifier)) {
+				report.append<Identifier>(identifier);
+			}
+		}
+	});
+	storeMessage(report);
+}
+
+void RealTimeForwardingControlService::addStructuresToHousekeepingConfiguration(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::AddStructuresToHousekeepingConfiguration)) {
+		return;
+	}
+	addIdentifiersToConfiguration(request, housekeepingConfiguration);
+}
+
+void RealTimeForwardingControlService::deleteStructuresFromHousekeepingConfiguration(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DeleteStructuresFromHousekeepingConfiguration)) {
+		return;
+	}
+	deleteIdentifiersFromConfiguration(request, housekeepingConfiguration);
+}
+
+void RealTimeForwardingControlService::reportHousekeepingConfigurationContent(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::ReportHousekeepingConfigurationContent)) {
+		return;
+	}
+	housekeepingConfigurationContentReport();
+}
+
+void RealTimeForwardingControlService::housekeepingConfigurationContentReport() {
+	identifierConfigurationContentReport(MessageType::HousekeepingConfigurationContentReport, housekeepingConfiguration);
+}
+
+void RealTimeForwardingControlService::addEventDefinitionsToEventReportConfiguration(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::AddEventDefinitionsToEventReportConfiguration)) {
+		return;
+	}
+	addIdentifiersToConfiguration(request, eventReportConfiguration);
+}
+
+void RealTimeForwardingControlService::deleteEventDefinitionsFromEventReportConfiguration(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DeleteEventDefinitionsFromEventReportConfiguration)) {
+		return;
+	}
+	deleteIdentifiersFromConfiguration(request, eventReportConfiguration);
+}
+
+void RealTimeForwardingControlService::reportEventReportConfigurationContent(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::ReportEventReportConfigurationContent)) {
+		return;
+	}
+	eventReportConfigurationContentReport();
+}
+
+void RealTimeForwardingControlService::eventReportConfigurationContentReport() {
+	identifierConfigurationContentReport(MessageType::EventReportConfigurationContentReport, eventReportConfiguration);
+}
+
 void RealTimeForwardingControlService::execute(Message& message) {
 	switch (message.messageType) {
 		case AddReportTypesToAppProcessConfiguration:
@@ -338,6 +516,24 @@ void RealTimeForwardingControlService::execute(Message& message) {
 		case ReportAppProcessConfigurationContent:
 			reportAppProcessConfigurationContent(message);
 			break;
+		case AddStructuresToHousekeepingConfiguration:
+			addStructuresToHousekeepingConfiguration(message);
+			break;
+		case DeleteStructuresFromHousekeepingConfiguration:
+			deleteStructuresFromHousekeepingConfiguration(message);
+			break;
+		case ReportHousekeepingConfigurationContent:
+			reportHousekeepingConfigurationContent(message);
+			break;
+		case AddEventDefinitionsToEventReportConfiguration:
+			addEventDefinitionsToEventReportConfiguration(message);
+			break;
+		case DeleteEventDefinitionsFromEventReportConfiguration:
+			deleteEventDefinitionsFromEventReportConfiguration(message);
+			break;
+		case ReportEventReportConfigurationContent:
+			reportEventReportConfigurationContent(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
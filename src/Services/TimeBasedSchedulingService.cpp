@@ -5,23 +5,179 @@
 
 TimeBasedSchedulingService::TimeBasedSchedulingService() {
 	serviceType = TimeBasedSchedulingService::ServiceType;
+	subScheduleStatus.fill(true);
+	groupStatus.fill(true);
 }
 
 Time::DefaultCUC TimeBasedSchedulingService::executeScheduledActivity(Time::DefaultCUC currentTime) {
-	if (currentTime >= scheduledActivities.front().requestReleaseTime && !scheduledActivities.empty()) {
-		if (scheduledActivities.front().requestID.applicationID == ApplicationId) {
-			MessageParser::execute(scheduledActivities.front().request);
+	return executeScheduledActivities(currentTime, 1);
+}
+
+Time::DefaultCUC TimeBasedSchedulingService::executeScheduledActivities(Time::DefaultCUC currentTime, uint16_t releaseBudget) {
+	// The activity is removed before its request is executed, as the request may change the schedule
+	scheduledActivities.releaseDue(currentTime, releaseBudget, [this](auto slot, const ScheduledActivity& activity) {
+		Message request = scheduledRequest(slot);
+		detachActivity(slot);
+		if (activity.requestID.applicationID == ApplicationId) {
+			MessageParser::execute(request);
 		}
-		scheduledActivities.pop_front();
-	}
+	});
 
-	if (!scheduledActivities.empty()) {
-		return scheduledActivities.front().requestReleaseTime;
+	// Parked activities are not released, so they are not considered
+	const auto nextActivity = scheduledActivities.front();
+	if (nextActivity != scheduledActivities.NoSlot) {
+		return scheduledActivities[nextActivity].requestReleaseTime;
 	} else {
 		return Time::DefaultCUC::max();
 	}
 }
 
+TimeBasedSchedulingService::RequestID TimeBasedSchedulingService::readRequestID(Message& request) {
+	RequestID requestID;
+	requestID.sourceID = request.read<SourceId>();
+	requestID.applicationID = request.read<ApplicationProcessId>();
+	requestID.sequenceCount = request.read<SequenceCount>();
+	return requestID;
+}
+
+Message TimeBasedSchedulingService::scheduledRequest(ScheduledActivitySlot slot) const {
+	const auto storedRequest = scheduledRequests.get(slot);
+
+	// The same fields as MessageParser::parseECSSTC, with the trailing zeros restored
+	Message request;
+	request.packetType = Message::TC;
+	request.serviceType = storedRequest[1];
+	request.messageType = storedRequest[2];
+	request.sourceId = (storedRequest[3] << 8) + storedRequest[4];
+	std::copy(storedRequest.begin() + ECSSSecondaryTCHeaderSize, storedRequest.end(), request.data);
+	request.dataSize = ECSSTCRequestStringSize - ECSSSecondaryTCHeaderSize;
+	return request;
+}
+
+void TimeBasedSchedulingService::detachActivity(ScheduledActivitySlot slot) {
+	scheduledRequests.release(slot);
+	subScheduleActivities.remove(slot);
+	groupActivities.remove(slot);
+}
+
+void TimeBasedSchedulingService::removeActivity(ScheduledActivitySlot slot) {
+	detachActivity(slot);
+	scheduledActivities.erase(slot);
+}
+
+void TimeBasedSchedulingService::updateReleaseStatus(ScheduledActivitySlot slot) {
+	const ScheduledActivity& activity = scheduledActivities[slot];
+	if (subScheduleStatus[activity.subScheduleID] && groupStatus[activity.groupID]) {
+		scheduledActivities.unpark(slot);
+	} else {
+		scheduledActivities.park(slot);
+	}
+}
+
+void TimeBasedSchedulingService::setSubScheduleStatus(SubScheduleId subScheduleID, bool enabled) {
+	subScheduleStatus[subScheduleID] = enabled;
+	subScheduleActivities.forEach(subScheduleID, [this](auto slot) {
+		updateReleaseStatus(slot);
+	});
+}
+
+void TimeBasedSchedulingService::setGroupStatus(ScheduleGroupId groupID, bool enabled) {
+	groupStatus[groupID] = enabled;
+	groupActivities.forEach(groupID, [this](auto slot) {
+		updateReleaseStatus(slot);
+	});
+}
+
+bool TimeBasedSchedulingService::timeShiftGroup(ScheduleGroupId groupID, Time::RelativeTime relativeOffset) {
+	const Time::DefaultCUC earliestAllowedTime = TimeGetter::getCurrentTimeDefaultCUC() + ECSSTimeMarginForActivation;
+	const auto offset = std::chrono::seconds(relativeOffset);
+
+	bool allowed = true;
+	groupActivities.forEach(groupID, [this, &allowed, &earliestAllowedTime, &offset](auto slot) {
+		if ((scheduledActivities[slot].requestReleaseTime + offset) < earliestAllowedTime) {
+			allowed = false;
+		}
+	});
+	if (!allowed) {
+		return false;
+	}
+
+	groupActivities.forEach(groupID, [this, &offset](auto slot) {
+		scheduledActivities.shift(slot, offset);
+	});
+	return true;
+}
+
+void TimeBasedSchedulingService::deleteGroupActivities(ScheduleGroupId groupID) {
+	groupActivities.forEach(groupID, [this](auto slot) {
+		removeActivity(slot);
+	});
+}
+
+void TimeBasedSchedulingService::enableSubSchedules(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::EnableTimeBasedSubSchedules)) {
+		return;
+	}
+
+	uint16_t iterationCount = request.readUint16();
+	while (iterationCount-- != 0) {
+		const auto subScheduleID = request.read<SubScheduleId>();
+		if (subScheduleID >= ECSSMaxNumberOfTimeSchedSubSchedules) {
+			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+			continue;
+		}
+		setSubScheduleStatus(subScheduleID, true);
+	}
+}
+
+void TimeBasedSchedulingService::disableSubSchedules(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DisableTimeBasedSubSchedules)) {
+		return;
+	}
+
+	uint16_t iterationCount = request.readUint16();
+	while (iterationCount-- != 0) {
+		const auto subScheduleID = request.read<SubScheduleId>();
+		if (subScheduleID >= ECSSMaxNumberOfTimeSchedSubSchedules) {
+			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+			continue;
+		}
+		setSubScheduleStatus(subScheduleID, false);
+	}
+}
+
+void TimeBasedSchedulingService::enableGroups(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::EnableTimeBasedScheduleGroups)) {
+		return;
+	}
+
+	uint16_t iterationCount = request.readUint16();
+	while (iterationCount-- != 0) {
+		const auto groupID = request.read<ScheduleGroupId>();
+		if (groupID >= ECSSMaxNumberOfTimeSchedGroups) {
+			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+			continue;
+		}
+		setGroupStatus(groupID, true);
+	}
+}
+
+void TimeBasedSchedulingService::disableGroups(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DisableTimeBasedScheduleGroups)) {
+		return;
+	}
+
+	uint16_t iterationCount = request.readUint16();
+	while (iterationCount-- != 0) {
+		const auto groupID = request.read<ScheduleGroupId>();
+		if (groupID >= ECSSMaxNumberOfTimeSchedGroups) {
+			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+			continue;
+		}
+		setGroupStatus(groupID, false);
+	}
+}
+
 void TimeBasedSchedulingService::enableScheduleExecution(Message& request) {
 	if (!request.assertTC(ServiceType, MessageType::EnableTimeBasedScheduleExecutionFunction)) {
 		return;
@@ -42,7 +198,11 @@ void TimeBasedSchedulingService::resetSchedule(Message& request) {
 	}
 	executionFunctionStatus = false;
 	scheduledActivities.clear();
-	// todo: Add resetting for sub-schedules and groups, if defined
+	scheduledRequests.clear();
+	subScheduleActivities.clear();
+	groupActivities.clear();
+	subScheduleStatus.fill(true);
+	groupStatus.fill(true);
 }
 
 void TimeBasedSchedulingService::insertActivities(Message& request) {
@@ -50,33 +210,57 @@ void TimeBasedSchedulingService::insertActivities(Message& request) {
 		return;
 	}
 
-	// todo: Get the sub-schedule ID if they are implemented
+#if SUB_SCHEDULES_ENABLED
+	const auto subScheduleID = request.read<SubScheduleId>();
+	if (subScheduleID >= ECSSMaxNumberOfTimeSchedSubSchedules) {
+		ErrorHandler::reportError(request, ErrorHandler::SubServiceExecutionStartError);
+		return;
+	}
+#else
+	const SubScheduleId subScheduleID = 0;
+#endif
+
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		// todo: Get the group ID first, if groups are used
+#if GROUPS_ENABLED
+		const auto groupID = request.read<ScheduleGroupId>();
+#else
+		const ScheduleGroupId groupID = 0;
+#endif
 		Time::DefaultCUC currentTime = TimeGetter::getCurrentTimeDefaultCUC();
 
 		Time::DefaultCUC releaseTime = request.readDefaultCUCTimeStamp();
-		if ((scheduledActivities.available() == 0) || (releaseTime < (currentTime + ECSSTimeMarginForActivation))) {
+		uint8_t requestData[ECSSTCRequestStringSize] = {0};
+		request.readString(requestData, ECSSTCRequestStringSize);
+
+		// The trailing zeros of the request are not stored, as they are restored when it is released
+		uint8_t requestLength = ECSSTCRequestStringSize;
+		while (requestLength > ECSSSecondaryTCHeaderSize && requestData[requestLength - 1] == 0) {
+			requestLength--;
+		}
+
+		if (scheduledActivities.full() || !scheduledRequests.canStore(requestLength) ||
+		    (groupID >= ECSSMaxNumberOfTimeSchedGroups) || (releaseTime < (currentTime + ECSSTimeMarginForActivation))) {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
-			request.skipBytes(ECSSTCRequestStringSize);
 		} else {
-			uint8_t requestData[ECSSTCRequestStringSize] = {0};
-			request.readString(requestData, ECSSTCRequestStringSize);
-			Message receivedTCPacket = MessageParser::parseECSSTC(requestData);
+			ErrorHandler::assertRequest((requestData[0] >> 4) == ECSSPUSVersion, request, ErrorHandler::UnacceptableMessage);
 			ScheduledActivity newActivity;
 
-			newActivity.request = receivedTCPacket;
 			newActivity.requestReleaseTime = releaseTime;
+			newActivity.subScheduleID = subScheduleID;
+			newActivity.groupID = groupID;
 
 			newActivity.requestID.sourceID = request.sourceId;
 			newActivity.requestID.applicationID = request.applicationId;
 			newActivity.requestID.sequenceCount = request.packetSequenceCount;
 
-			scheduledActivities.push_back(newActivity);
+			const bool released = subScheduleStatus[subScheduleID] && groupStatus[groupID];
+			const auto slot = scheduledActivities.insert(newActivity, !released);
+			scheduledRequests.store(slot, requestData, requestLength);
+			subScheduleActivities.add(slot, subScheduleID);
+			groupActivities.add(slot, groupID);
 		}
 	}
-	sortActivitiesReleaseTime(scheduledActivities);
 	notifyNewActivityAddition();
 }
 
@@ -87,20 +271,17 @@ void TimeBasedSchedulingService::timeShiftAllActivities(Message& request) {
 
 	Time::DefaultCUC current_time = TimeGetter::getCurrentTimeDefaultCUC();
 
-	const auto releaseTimes =
-	    etl::minmax_element(scheduledActivities.begin(), scheduledActivities.end(),
-	                        [](ScheduledActivity const& leftSide, ScheduledActivity const& rightSide) {
-		                        return leftSide.requestReleaseTime < rightSide.requestReleaseTime;
-	                        });
 	// todo: Define what the time format is going to be
 	Time::RelativeTime relativeOffset = request.readRelativeTime();
-	if ((releaseTimes.first->requestReleaseTime + std::chrono::seconds(relativeOffset)) < (current_time + ECSSTimeMarginForActivation)) {
+	// The parked activities are shifted too, so they are also checked against the time margin
+	const auto earliestActivity = scheduledActivities.earliest();
+	if (earliestActivity != scheduledActivities.NoSlot &&
+	    (scheduledActivities[earliestActivity].requestReleaseTime + std::chrono::seconds(relativeOffset)) <
+	        (current_time + ECSSTimeMarginForActivation)) {
 		ErrorHandler::reportError(request, ErrorHandler::SubServiceExecutionStartError);
 		return;
 	}
-	for (auto& activity: scheduledActivities) {
-		activity.requestReleaseTime += std::chrono::seconds(relativeOffset);
-	}
+	scheduledActivities.shiftAll(std::chrono::seconds(relativeOffset));
 }
 
 void TimeBasedSchedulingService::timeShiftActivitiesByID(Message& request) {
@@ -113,28 +294,19 @@ void TimeBasedSchedulingService::timeShiftActivitiesByID(Message& request) {
 	auto relativeOffset = std::chrono::seconds(request.readRelativeTime());
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.read<SourceId>();
-		receivedRequestID.applicationID = request.read<ApplicationProcessId>();
-		receivedRequestID.sequenceCount = request.read<SequenceCount>();
-
-		auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                       [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                       return receivedRequestID != currentElement.requestID;
-		                                       });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			if ((requestIDMatch->requestReleaseTime + relativeOffset) <
+		const auto requestIDMatch = scheduledActivities.find(readRequestID(request));
+
+		if (requestIDMatch != scheduledActivities.NoSlot) {
+			if ((scheduledActivities[requestIDMatch].requestReleaseTime + relativeOffset) <
 			    (current_time + ECSSTimeMarginForActivation)) {
 				ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 			} else {
-				requestIDMatch->requestReleaseTime += relativeOffset;
+				scheduledActivities.shift(requestIDMatch, relativeOffset);
 			}
 		} else {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 		}
 	}
-	sortActivitiesReleaseTime(scheduledActivities);
 }
 
 void TimeBasedSchedulingService::deleteActivitiesByID(Message& request) {
@@ -144,18 +316,10 @@ void TimeBasedSchedulingService::deleteActivitiesByID(Message& request) {
 
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.read<SourceId>();
-		receivedRequestID.applicationID = request.read<ApplicationProcessId>();
-		receivedRequestID.sequenceCount = request.read<SequenceCount>();
-
-		const auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                             [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                             return receivedRequestID != currentElement.requestID;
-		                                             });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			scheduledActivities.erase(requestIDMatch);
+		const auto requestIDMatch = scheduledActivities.find(readRequestID(request));
+
+		if (requestIDMatch != scheduledActivities.NoSlot) {
+			removeActivity(requestIDMatch);
 		} else {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 		}
@@ -167,19 +331,128 @@ void TimeBasedSchedulingService::detailReportAllActivities(Message& request) {
 		return;
 	}
 
-	timeBasedScheduleDetailReport(scheduledActivities);
+	timeBasedScheduleDetailReport(scheduledActivities.slotsInReleaseOrder());
+}
+
+void TimeBasedSchedulingService::timeBasedScheduleDetailReport(const ScheduledActivitySlots& listOfActivities,
+                                                               uint16_t activitiesPerReport) {
+	activitiesPerReport = std::clamp<uint16_t>(activitiesPerReport, 1, MaxActivitiesPerDetailReport);
+	size_t reportedActivities = 0;
+	do {
+		const auto activityCount = static_cast<uint16_t>(
+		    std::min<size_t>(listOfActivities.size() - reportedActivities, activitiesPerReport));
+
+		Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduleReportById);
+		report.appendUint16(activityCount);
+
+		for (size_t index = reportedActivities; index < reportedActivities + activityCount; index++) {
+			const auto slot = listOfActivities[index];
+			const ScheduledActivity& activity = scheduledActivities[slot];
+#if SUB_SCHEDULES_ENABLED
+			report.append<SubScheduleId>(activity.subScheduleID);
+#endif
+#if GROUPS_ENABLED
+			report.append<ScheduleGroupId>(activity.groupID);
+#endif
+			report.appendDefaultCUCTimeStamp(activity.requestReleaseTime); // todo: Replace with the time parser
+			report.appendString(MessageParser::composeECSS(scheduledRequest(slot)));
+		}
+		storeMessage(report);
+		reportedActivities += activityCount;
+	} while (reportedActivities < listOfActivities.size());
+}
+
+bool TimeBasedSchedulingService::readActivityFilter(Message& request, ScheduledActivitySlots& matchedActivities) {
+	Time::DefaultCUC startTime = Time::DefaultCUC(0);
+	Time::DefaultCUC endTime = Time::DefaultCUC::max();
+
+	const auto timeWindowType = static_cast<TimeWindowType>(request.readEnum8());
+	switch (timeWindowType) {
+		case SelectAll:
+			break;
+		case FromTagToTag:
+			startTime = request.readDefaultCUCTimeStamp();
+			endTime = request.readDefaultCUCTimeStamp();
+			if (endTime < startTime) {
+				ErrorHandler::reportError(request, ErrorHandler::InvalidTimeWindow);
+				return false;
+			}
+			break;
+		case FromTag:
+			startTime = request.readDefaultCUCTimeStamp();
+			break;
+		case ToTag:
+			endTime = request.readDefaultCUCTimeStamp();
+			break;
+		default:
+			ErrorHandler::reportError(request, ErrorHandler::SubServiceExecutionStartError);
+			return false;
+	}
+
+	// An empty list of sub-schedules or groups selects all of them
+	etl::array<bool, ECSSMaxNumberOfTimeSchedSubSchedules> selectedSubSchedules;
+	selectedSubSchedules.fill(true);
+#if SUB_SCHEDULES_ENABLED
+	uint16_t subScheduleCount = request.readUint16();
+	if (subScheduleCount != 0) {
+		selectedSubSchedules.fill(false);
+	}
+	while (subScheduleCount-- != 0) {
+		const auto subScheduleID = request.read<SubScheduleId>();
+		if (subScheduleID >= ECSSMaxNumberOfTimeSchedSubSchedules) {
+			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+			continue;
+		}
+		selectedSubSchedules[subScheduleID] = true;
+	}
+#endif
+
+	etl::array<bool, ECSSMaxNumberOfTimeSchedGroups> selectedGroups;
+	selectedGroups.fill(true);
+#if GROUPS_ENABLED
+	uint16_t groupCount = request.readUint16();
+	if (groupCount != 0) {
+		selectedGroups.fill(false);
+	}
+	while (groupCount-- != 0) {
+		const auto groupID = request.read<ScheduleGroupId>();
+		if (groupID >= ECSSMaxNumberOfTimeSchedGroups) {
+			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+			continue;
+		}
+		selectedGroups[groupID] = true;
+	}
+#endif
+
+	matchedActivities = scheduledActivities.scanReleasedUntil(startTime, endTime);
+	auto unselectedActivities = std::remove_if(matchedActivities.begin(), matchedActivities.end(), [this, &selectedSubSchedules, &selectedGroups](auto slot) {
+		const ScheduledActivity& activity = scheduledActivities[slot];
+		return !selectedSubSchedules[activity.subScheduleID] || !selectedGroups[activity.groupID];
+	});
+	matchedActivities.erase(unselectedActivities, matchedActivities.end());
+	return true;
+}
+
+void TimeBasedSchedulingService::detailReportActivitiesByFilter(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DetailReportActivitiesByFilter)) {
+		return;
+	}
+
+	ScheduledActivitySlots matchedActivities;
+	if (readActivityFilter(request, matchedActivities)) {
+		timeBasedScheduleDetailReport(matchedActivities);
+	}
 }
 
-void TimeBasedSchedulingService::timeBasedScheduleDetailReport(const etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& listOfActivities) {
-	// todo: append sub-schedule and group ID if they are defined
-	Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduleReportById);
-	report.appendUint16(static_cast<uint16_t>(listOfActivities.size()));
+void TimeBasedSchedulingService::summaryReportActivitiesByFilter(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::ActivitiesSummaryReportByFilter)) {
+		return;
+	}
 
-	for (const auto& activity: listOfActivities) {
-		report.appendDefaultCUCTimeStamp(activity.requestReleaseTime); // todo: Replace with the time parser
-		report.appendString(MessageParser::composeECSS(activity.request));
+	ScheduledActivitySlots matchedActivities;
+	if (readActivityFilter(request, matchedActivities)) {
+		timeBasedScheduleSummaryReport(matchedActivities);
 	}
-	storeMessage(report);
 }
 
 void TimeBasedSchedulingService::detailReportActivitiesByID(Message& request) {
@@ -187,28 +460,20 @@ void TimeBasedSchedulingService::detailReportActivitiesByID(Message& request) {
 		return;
 	}
 
-	etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> matchedActivities;
+	ScheduledActivitySlots matchedActivities;
 
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.read<SourceId>();
-		receivedRequestID.applicationID = request.read<ApplicationProcessId>();
-		receivedRequestID.sequenceCount = request.read<SequenceCount>();
-
-		const auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                             [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                             return receivedRequestID != currentElement.requestID;
-		                                             });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			matchedActivities.push_back(*requestIDMatch);
+		const auto requestIDMatch = scheduledActivities.find(readRequestID(request));
+
+		if (requestIDMatch != scheduledActivities.NoSlot) {
+			matchedActivities.push_back(requestIDMatch);
 		} else {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 		}
 	}
 
-	sortActivitiesReleaseTime(matchedActivities);
+	scheduledActivities.sortByReleaseTime(matchedActivities);
 
 	timeBasedScheduleDetailReport(matchedActivities);
 }
@@ -218,44 +483,50 @@ void TimeBasedSchedulingService::summaryReportActivitiesByID(Message& request) {
 		return;
 	}
 
-	etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> matchedActivities;
+	ScheduledActivitySlots matchedActivities;
 
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.read<SourceId>();
-		receivedRequestID.applicationID = request.read<ApplicationProcessId>();
-		receivedRequestID.sequenceCount = request.read<SequenceCount>();
-
-		auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                       [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                       return receivedRequestID != currentElement.requestID;
-		                                       });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			matchedActivities.push_back(*requestIDMatch);
+		const auto requestIDMatch = scheduledActivities.find(readRequestID(request));
+
+		if (requestIDMatch != scheduledActivities.NoSlot) {
+			matchedActivities.push_back(requestIDMatch);
 		} else {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 		}
 	}
-	sortActivitiesReleaseTime(matchedActivities);
+	scheduledActivities.sortByReleaseTime(matchedActivities);
 
 	timeBasedScheduleSummaryReport(matchedActivities);
 }
 
-void TimeBasedSchedulingService::timeBasedScheduleSummaryReport(const etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& listOfActivities) {
-	Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduledSummaryReport);
-
-	// todo: append sub-schedule and group ID if they are defined
-	report.appendUint16(static_cast<uint16_t>(listOfActivities.size()));
-	for (const auto& match: listOfActivities) {
-		// todo: append sub-schedule and group ID if they are defined
-		report.appendDefaultCUCTimeStamp(match.requestReleaseTime);
-		report.append<SourceId>(match.requestID.sourceID);
-		report.append<ApplicationProcessId>(match.requestID.applicationID);
-		report.append<SequenceCount>(match.requestID.sequenceCount);
-	}
-	storeMessage(report);
+void TimeBasedSchedulingService::timeBasedScheduleSummaryReport(const ScheduledActivitySlots& listOfActivities,
+                                                                uint16_t activitiesPerReport) {
+	activitiesPerReport = std::clamp<uint16_t>(activitiesPerReport, 1, MaxActivitiesPerSummaryReport);
+	size_t reportedActivities = 0;
+	do {
+		const auto activityCount = static_cast<uint16_t>(
+		    std::min<size_t>(listOfActivities.size() - reportedActivities, activitiesPerReport));
+
+		Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduledSummaryReport);
+		report.appendUint16(activityCount);
+
+		for (size_t index = reportedActivities; index < reportedActivities + activityCount; index++) {
+			const ScheduledActivity& match = scheduledActivities[listOfActivities[index]];
+#if SUB_SCHEDULES_ENABLED
+			report.append<SubScheduleId>(match.subScheduleID);
+#endif
+#if GROUPS_ENABLED
+			report.append<ScheduleGroupId>(match.groupID);
+#endif
+			report.appendDefaultCUCTimeStamp(match.requestReleaseTime);
+			report.append<SourceId>(match.requestID.sourceID);
+			report.append<ApplicationProcessId>(match.requestID.applicationID);
+			report.append<SequenceCount>(match.requestID.sequenceCount);
+		}
+		storeMessage(report);
+		reportedActivities += activityCount;
+	} while (reportedActivities < listOfActivities.size());
 }
 
 void TimeBasedSchedulingService::execute(Message& message) {
@@ -290,6 +561,24 @@ void TimeBasedSchedulingService::execute(Message& message) {
 		case DetailReportAllScheduledActivities:
 			detailReportAllActivities(message);
 			break;
+		case DetailReportActivitiesByFilter:
+			detailReportActivitiesByFilter(message);
+			break;
+		case ActivitiesSummaryReportByFilter:
+			summaryReportActivitiesByFilter(message);
+			break;
+		case EnableTimeBasedSubSchedules:
+			enableSubSchedules(message);
+			break;
+		case DisableTimeBasedSubSchedules:
+			disableSubSchedules(message);
+			break;
+		case EnableTimeBasedScheduleGroups:
+			enableGroups(message);
+			break;
+		case DisableTimeBasedScheduleGroups:
+			disableGroups(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
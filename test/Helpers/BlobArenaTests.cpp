@@ -0,0 +1,91 @@
+#include "Helpers/BlobArena.hpp"
+#include <memory>
+#include <vector>
+#include "catch2/catch_all.hpp"
+
+namespace {
+	template <size_t Size, size_t MaxHandles>
+	std::vector<uint8_t> blob(const BlobArena<Size, MaxHandles>& arena, uint16_t handle) {
+		auto data = arena.get(handle);
+		return {data.begin(), data.end()};
+	}
+} // namespace
+
+TEST_CASE("Blob arena") {
+	const std::vector<uint8_t> shortBlob = {1, 2, 3};
+	const std::vector<uint8_t> longBlob = {4, 5, 6, 7, 8, 9, 10, 11};
+
+	SECTION("Store and release") {
+		BlobArena<64, 4> arena;
+		CHECK(arena.store(0, shortBlob.data(), shortBlob.size()));
+		CHECK(arena.store(3, longBlob.data(), longBlob.size()));
+		CHECK(arena.used() == 2 * BlobArena<64, 4>::BlobHeaderSize + shortBlob.size() + longBlob.size());
+
+		CHECK(blob(arena, 0) == shortBlob);
+		CHECK(blob(arena, 3) == longBlob);
+		CHECK(arena.get(1).empty());
+
+		// A handle can only have one blob
+		CHECK_FALSE(arena.store(0, longBlob.data(), longBlob.size()));
+
+		arena.release(0);
+		CHECK(arena.get(0).empty());
+		CHECK(blob(arena, 3) == longBlob);
+		CHECK(arena.used() == BlobArena<64, 4>::BlobHeaderSize + longBlob.size());
+
+		arena.clear();
+		CHECK(arena.used() == 0);
+		CHECK(arena.get(3).empty());
+	}
+
+	SECTION("Free space is reclaimed by compaction") {
+		// Room for exactly two blobs of 8 bytes
+		BlobArena<22, 4> arena;
+		CHECK(arena.store(0, longBlob.data(), longBlob.size()));
+		CHECK(arena.store(1, longBlob.data(), longBlob.size()));
+		CHECK_FALSE(arena.canStore(longBlob.size()));
+		CHECK_FALSE(arena.store(2, longBlob.data(), longBlob.size()));
+
+		// The hole at the start of the arena is only usable after the second blob is moved
+		arena.release(0);
+		CHECK(arena.canStore(longBlob.size()));
+		CHECK(arena.store(2, longBlob.data(), longBlob.size()));
+
+		CHECK(blob(arena, 1) == longBlob);
+		CHECK(blob(arena, 2) == longBlob);
+		CHECK_FALSE(arena.canStore(0));
+
+		// Releasing the last blob frees its space without compaction
+		arena.release(2);
+		CHECK(arena.store(3, shortBlob.data(), shortBlob.size()));
+		CHECK(blob(arena, 3) == shortBlob);
+	}
+
+	SECTION("Blobs longer than the maximum length are rejected") {
+		BlobArena<1024, 1> arena;
+		const std::vector<uint8_t> hugeBlob(BlobArena<1024, 1>::MaxBlobLength + 1);
+		CHECK_FALSE(arena.store(0, hugeBlob.data(), hugeBlob.size()));
+		CHECK(arena.store(0, hugeBlob.data(), hugeBlob.size() - 1));
+	}
+
+	SECTION("Blobs beyond 64 KiB") {
+		using LargeArena = BlobArena<70000, 300>;
+		auto arena = std::make_unique<LargeArena>();
+		std::vector<uint8_t> data(LargeArena::MaxBlobLength);
+
+		const uint16_t blobs = LargeArena::capacity() / (LargeArena::BlobHeaderSize + data.size());
+		for (uint16_t handle = 0; handle < blobs; handle++) {
+			std::fill(data.begin(), data.end(), handle & 0xFF);
+			REQUIRE(arena->store(handle, data.data(), data.size()));
+		}
+		CHECK(arena->used() > UINT16_MAX);
+		CHECK(blob(*arena, blobs - 1) == data);
+
+		// Compaction moves blobs across the 64 KiB boundary
+		arena->release(0);
+		CHECK(arena->store(blobs, data.data(), data.size()));
+		CHECK(blob(*arena, blobs) == data);
+		std::fill(data.begin(), data.end(), (blobs - 1) & 0xFF);
+		CHECK(blob(*arena, blobs - 1) == data);
+	}
+}
@@ -0,0 +1,69 @@
+#include "Helpers/EventIndexedMap.hpp"
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Event indexed map") {
+	EventIndexedMap<uint32_t, 8> map;
+
+	SECTION("Insertion and lookup") {
+		CHECK(map.empty());
+		CHECK(map.insert({3, 30}).second);
+		CHECK(map.insert({7, 70}).second);
+		CHECK(map.size() == 2);
+
+		REQUIRE(map.find(7) != map.end());
+		CHECK(map.find(7)->second == 70);
+		CHECK(map.find(4) == map.end());
+		CHECK(map.count(3) == 1);
+		CHECK(map.count(4) == 0);
+
+		// Existing definitions are not replaced
+		auto result = map.insert({3, 31});
+		CHECK(not result.second);
+		CHECK(result.first->second == 30);
+		CHECK(map.size() == 2);
+	}
+
+	SECTION("Colliding event definition IDs") {
+		// With a capacity of 8 the index has 16 entries, so these IDs share the same home position
+		for (EventDefinitionId id: {5, 21, 37, 6}) {
+			CHECK(map.insert({id, id * 10U}).second);
+		}
+		for (EventDefinitionId id: {5, 21, 37, 6}) {
+			REQUIRE(map.find(id) != map.end());
+			CHECK(map.find(id)->second == id * 10U);
+		}
+
+		// Removing the start of a probe sequence keeps the rest of it reachable
+		CHECK(map.erase(5) == 1);
+		CHECK(map.find(5) == map.end());
+		CHECK(map.find(21)->second == 210);
+		CHECK(map.find(37)->second == 370);
+		CHECK(map.find(6)->second == 60);
+		CHECK(map.erase(5) == 0);
+		CHECK(map.size() == 3);
+	}
+
+	SECTION("Removal moves the last definition") {
+		for (EventDefinitionId id = 0; id < 8; id++) {
+			map.insert({id, id});
+		}
+		CHECK(map.full());
+		CHECK(not map.insert({100, 0}).second);
+
+		auto next = map.erase(map.find(2));
+		CHECK(next->first == 7);
+		CHECK(map.find(7)->second == 7);
+		CHECK(map.insert({100, 100}).second);
+		CHECK(map.find(100)->second == 100);
+
+		uint32_t sum = 0;
+		for (auto& element: map) {
+			sum += element.second;
+		}
+		CHECK(sum == 0 + 1 + 3 + 4 + 5 + 6 + 7 + 100);
+
+		map.clear();
+		CHECK(map.empty());
+		CHECK(map.find(7) == map.end());
+	}
+}
@@ -0,0 +1,114 @@
+#include <filesystem>
+#include <fstream>
+#include "Platform/x86/Helpers/FilesystemRoot.hpp"
+#include "catch2/catch_all.hpp"
+
+namespace fs = std::filesystem;
+
+using namespace Filesystem;
+
+namespace {
+	/**
+	 * An empty temporary directory, which is the root directory of the filesystem while this object exists
+	 */
+	struct TemporaryRoot {
+		const fs::path path = fs::temp_directory_path() / "filesystem_root";
+
+		TemporaryRoot() {
+			fs::remove_all(path);
+			fs::create_directories(path);
+			setRootDirectory(path.c_str());
+		}
+
+		~TemporaryRoot() {
+			setRootDirectory("");
+			std::error_code error;
+			fs::remove_all(path, error);
+		}
+	};
+} // namespace
+
+TEST_CASE("Filesystem paths are resolved under the root directory") {
+	const TemporaryRoot temporaryRoot;
+	const fs::path& root = temporaryRoot.path;
+
+	CHECK(not createDirectory("repository"));
+	CHECK(fs::is_directory(root / "repository"));
+	CHECK(getNodeType(Path("repository")) == NodeType::Directory);
+
+	CHECK(not createFile("repository/file"));
+	CHECK(fs::is_regular_file(root / "repository/file"));
+	CHECK(getNodeType(Path("repository/file")) == NodeType::File);
+	CHECK(not getNodeType(Path("repository/missing")));
+
+	SECTION("Paths leaving the root directory are rejected") {
+		CHECK(createFile("../escaped") == FileCreationError::UnknownError);
+		CHECK(createDirectory("repository/../../escaped") == DirectoryCreationError::UnknownError);
+		CHECK(not getNodeType(Path("repository/..")));
+		CHECK(not fs::exists(root.parent_path() / "escaped"));
+	}
+
+	SECTION("Absolute paths are resolved under the root directory") {
+		const Path absolutePath = (root / "repository").c_str();
+		CHECK(getNodeType(Path("/repository")) == NodeType::Directory);
+		CHECK(not getNodeType(absolutePath));
+
+		setRootDirectory("");
+		CHECK(not getNodeType(absolutePath));
+		CHECK(not getNodeType(Path("/")));
+	}
+}
+
+TEST_CASE("Filesystem file and directory errors") {
+	const TemporaryRoot temporaryRoot;
+	const fs::path& root = temporaryRoot.path;
+	fs::create_directories(root / "repository");
+	std::ofstream(root / "repository/file") << "Hello, world!";
+
+	SECTION("Creation of existing objects") {
+		CHECK(createFile("repository/file") == FileCreationError::FileAlreadyExists);
+		CHECK(createDirectory("repository") == DirectoryCreationError::DirectoryAlreadyExists);
+	}
+
+	SECTION("Deletion of files") {
+		CHECK(deleteFile("repository/missing") == FileDeletionError::FileDoesNotExist);
+		CHECK(deleteFile("repository") == FileDeletionError::PathLeadsToDirectory);
+		CHECK(not deleteFile("repository/file"));
+		CHECK(not fs::exists(root / "repository/file"));
+	}
+
+	SECTION("Deletion of directories") {
+		CHECK(deleteDirectory("missing") == DirectoryDeletionError::DirectoryDoesNotExist);
+		CHECK(deleteDirectory("repository") == DirectoryDeletionError::DirectoryIsNotEmpty);
+		fs::remove(root / "repository/file");
+		CHECK(not deleteDirectory("repository"));
+		CHECK(not fs::exists(root / "repository"));
+	}
+
+	SECTION("Attributes") {
+		auto attributes = getFileAttributes("repository/file");
+		REQUIRE(attributes.is_value());
+		CHECK(attributes.value().sizeInBytes == 13);
+		CHECK(not attributes.value().isLocked);
+
+		CHECK(getFileAttributes("repository").error() == FileAttributeError::PathLeadsToDirectory);
+		CHECK(getFileAttributes("repository/missing").error() == FileAttributeError::FileDoesNotExist);
+	}
+}
+
+TEST_CASE("Filesystem file locks") {
+	const TemporaryRoot temporaryRoot;
+	const fs::path& root = temporaryRoot.path;
+	REQUIRE(not createFile("file"));
+
+	CHECK(getFileLockStatus("file") == FileLockStatus::Unlocked);
+	lockFile("file");
+	REQUIRE(getFileLockStatus("file") == FileLockStatus::Locked);
+	CHECK(getFileAttributes("file").value().isLocked);
+	CHECK(deleteFile("file") == FileDeletionError::FileIsLocked);
+
+	unlockFile("file");
+	CHECK(getFileLockStatus("file") == FileLockStatus::Unlocked);
+	CHECK((fs::status(root / "file").permissions() & fs::perms::owner_write) != fs::perms::none);
+	CHECK(not deleteFile("file"));
+}
@@ -0,0 +1,145 @@
+#include "Helpers/LargePacketReassembler.hpp"
+#include <numeric>
+#include <vector>
+#include "catch2/catch_all.hpp"
+
+namespace {
+	using Reassembler = LargePacketReassembler<2, 20, 8>;
+	using PartType = Reassembler::PartType;
+	using PartResult = Reassembler::PartResult;
+
+	/**
+	 * Records the packets completed by a reassembler
+	 */
+	struct CompletedPackets {
+		std::vector<std::pair<LargeMessageTransactionId, std::vector<uint8_t>>> packets;
+
+		void operator()(LargeMessageTransactionId identifier, etl::span<const uint8_t> packet) {
+			packets.emplace_back(identifier, std::vector<uint8_t>(packet.begin(), packet.end()));
+		}
+	};
+
+	etl::span<const uint8_t> part(const std::vector<uint8_t>& payload, size_t sequenceNumber, size_t size) {
+		return etl::span<const uint8_t>(payload.data() + sequenceNumber * 8, size);
+	}
+} // namespace
+
+TEST_CASE("Large packet reassembly") {
+	std::vector<uint8_t> payload(20);
+	std::iota(payload.begin(), payload.end(), 0);
+	const Time::DefaultCUC now;
+	Reassembler reassembler;
+	CompletedPackets completed;
+
+	SECTION("Parts in order") {
+		CHECK(reassembler.receivePart(1, 0, PartType::First, part(payload, 0, 8), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(1, 1, PartType::Intermediate, part(payload, 1, 8), now, completed) == PartResult::Accepted);
+		CHECK(completed.packets.empty());
+		CHECK(reassembler.receivePart(1, 2, PartType::Last, part(payload, 2, 4), now, completed) == PartResult::Completed);
+
+		REQUIRE(completed.packets.size() == 1);
+		CHECK(completed.packets[0].first == 1);
+		CHECK(completed.packets[0].second == payload);
+		CHECK(reassembler.activeTransactions() == 0);
+	}
+
+	SECTION("Parts out of order") {
+		CHECK(reassembler.receivePart(1, 2, PartType::Last, part(payload, 2, 4), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(1, 0, PartType::First, part(payload, 0, 8), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(1, 1, PartType::Intermediate, part(payload, 1, 8), now, completed) == PartResult::Completed);
+
+		REQUIRE(completed.packets.size() == 1);
+		CHECK(completed.packets[0].second == payload);
+	}
+
+	SECTION("Interleaved transactions") {
+		CHECK(reassembler.receivePart(1, 0, PartType::First, part(payload, 0, 8), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(2, 0, PartType::First, part(payload, 1, 8), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(3, 0, PartType::First, part(payload, 0, 8), now, completed) == PartResult::NoFreeTransaction);
+		CHECK(reassembler.activeTransactions() == 2);
+
+		CHECK(reassembler.receivePart(2, 1, PartType::Last, part(payload, 0, 2), now, completed) == PartResult::Completed);
+		CHECK(reassembler.receivePart(1, 1, PartType::Last, part(payload, 1, 8), now, completed) == PartResult::Completed);
+
+		REQUIRE(completed.packets.size() == 2);
+		CHECK(completed.packets[0].first == 2);
+		CHECK(completed.packets[0].second == std::vector<uint8_t>{8, 9, 10, 11, 12, 13, 14, 15, 0, 1});
+		CHECK(completed.packets[1].first == 1);
+		CHECK(completed.packets[1].second == std::vector<uint8_t>(payload.begin(), payload.begin() + 16));
+	}
+
+	SECTION("A single last part is a whole packet") {
+		CHECK(reassembler.receivePart(1, 0, PartType::Last, part(payload, 0, 5), now, completed) == PartResult::Completed);
+
+		REQUIRE(completed.packets.size() == 1);
+		CHECK(completed.packets[0].second == std::vector<uint8_t>{0, 1, 2, 3, 4});
+	}
+
+	SECTION("Repeated parts are ignored") {
+		CHECK(reassembler.receivePart(1, 0, PartType::First, part(payload, 0, 8), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(1, 0, PartType::First, part(payload, 1, 8), now, completed) == PartResult::Duplicate);
+		CHECK(reassembler.receivePart(1, 1, PartType::Last, part(payload, 1, 8), now, completed) == PartResult::Completed);
+
+		REQUIRE(completed.packets.size() == 1);
+		CHECK(completed.packets[0].second == std::vector<uint8_t>(payload.begin(), payload.begin() + 16));
+	}
+
+	SECTION("Invalid parts") {
+		// Parts that do not fit their type
+		CHECK(reassembler.receivePart(1, 0, PartType::Intermediate, part(payload, 0, 8), now, completed) == PartResult::InvalidPart);
+		CHECK(reassembler.receivePart(1, 1, PartType::First, part(payload, 1, 8), now, completed) == PartResult::InvalidPart);
+		CHECK(reassembler.receivePart(1, 0, PartType::First, part(payload, 0, 7), now, completed) == PartResult::InvalidPart);
+		CHECK(reassembler.receivePart(1, 1, PartType::Last, part(payload, 1, 0), now, completed) == PartResult::InvalidPart);
+
+		// Parts beyond the maximum packet size
+		CHECK(reassembler.receivePart(1, 3, PartType::Last, part(payload, 0, 1), now, completed) == PartResult::InvalidPart);
+		CHECK(reassembler.receivePart(1, 2, PartType::Last, part(payload, 1, 5), now, completed) == PartResult::InvalidPart);
+		CHECK(reassembler.activeTransactions() == 0);
+
+		// Parts that do not fit the parts received before them
+		CHECK(reassembler.receivePart(1, 1, PartType::Last, part(payload, 1, 4), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(1, 2, PartType::Intermediate, part(payload, 2, 8), now, completed) == PartResult::InvalidPart);
+		CHECK(reassembler.receivePart(1, 2, PartType::Last, part(payload, 2, 4), now, completed) == PartResult::InvalidPart);
+
+		CHECK(reassembler.receivePart(2, 2, PartType::Intermediate, part(payload, 0, 8), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(2, 1, PartType::Last, part(payload, 1, 8), now, completed) == PartResult::InvalidPart);
+		CHECK(completed.packets.empty());
+	}
+
+	SECTION("The transaction is released before the packet is handed over") {
+		CHECK(reassembler.receivePart(1, 0, PartType::First, part(payload, 0, 8), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(2, 0, PartType::First, part(payload, 0, 8), now, completed) == PartResult::Accepted);
+
+		PartResult nestedResult = PartResult::InvalidPart;
+		auto handOver = [&](LargeMessageTransactionId identifier, etl::span<const uint8_t> packet) {
+			completed(identifier, packet);
+			CHECK(reassembler.activeTransactions() == 1);
+			nestedResult = reassembler.receivePart(3, 0, PartType::First, part(payload, 1, 8), now, completed);
+		};
+		CHECK(reassembler.receivePart(1, 1, PartType::Last, part(payload, 1, 8), now, handOver) == PartResult::Completed);
+
+		CHECK(nestedResult == PartResult::Accepted);
+		CHECK(reassembler.activeTransactions() == 2);
+		REQUIRE(completed.packets.size() == 1);
+		CHECK(completed.packets[0].second == std::vector<uint8_t>(payload.begin(), payload.begin() + 16));
+	}
+
+	SECTION("Stale transactions expire") {
+		using namespace std::chrono_literals;
+		CHECK(reassembler.receivePart(1, 0, PartType::First, part(payload, 0, 8), now, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(2, 0, PartType::First, part(payload, 0, 8), now + 30s, completed) == PartResult::Accepted);
+
+		CHECK(reassembler.expire(now + 60s, 60s) == 0);
+		CHECK(reassembler.expire(now + 61s, 60s) == 1);
+		CHECK(reassembler.activeTransactions() == 1);
+
+		// The expired transaction starts again from its next part
+		CHECK(reassembler.receivePart(1, 1, PartType::Last, part(payload, 1, 8), now + 61s, completed) == PartResult::Accepted);
+		CHECK(reassembler.receivePart(2, 1, PartType::Last, part(payload, 1, 8), now + 61s, completed) == PartResult::Completed);
+		CHECK(completed.packets.size() == 1);
+		CHECK(reassembler.activeTransactions() == 1);
+
+		reassembler.clear();
+		CHECK(reassembler.activeTransactions() == 0);
+	}
+}
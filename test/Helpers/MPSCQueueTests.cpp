@@ -0,0 +1,70 @@
+#include "Helpers/MPSCQueue.hpp"
+#include <thread>
+#include <vector>
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("MPSC queue") {
+	SECTION("Elements are popped in the order in which they were pushed") {
+		MPSCQueue<uint32_t, 4> queue;
+		uint32_t value = 0;
+		CHECK(queue.empty());
+		CHECK_FALSE(queue.pop(value));
+
+		for (uint32_t i = 1; i <= 4; i++) {
+			CHECK(queue.push(i));
+		}
+		CHECK_FALSE(queue.push(5));
+		CHECK(queue.size() == 4);
+
+		for (uint32_t i = 1; i <= 4; i++) {
+			REQUIRE(queue.pop(value));
+			CHECK(value == i);
+		}
+		CHECK(queue.empty());
+	}
+
+	SECTION("Positions wrap around the ring") {
+		MPSCQueue<uint32_t, 2> queue;
+		uint32_t value = 0;
+		for (uint32_t i = 0; i < 10; i++) {
+			CHECK(queue.push(i));
+			REQUIRE(queue.pop(value));
+			CHECK(value == i);
+		}
+	}
+
+	SECTION("Concurrent producers") {
+		static MPSCQueue<uint32_t, 64> queue;
+		const uint32_t producerCount = 4;
+		const uint32_t valuesPerProducer = 10000;
+
+		std::vector<std::thread> producers;
+		for (uint32_t producer = 0; producer < producerCount; producer++) {
+			producers.emplace_back([producer]() {
+				for (uint32_t i = 0; i < valuesPerProducer; i++) {
+					while (not queue.push(producer * valuesPerProducer + i)) {
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+
+		// Every value must arrive once, and the values of each producer must stay in order
+		std::vector<uint32_t> nextValue(producerCount, 0);
+		uint32_t received = 0;
+		uint32_t value = 0;
+		while (received < producerCount * valuesPerProducer) {
+			if (queue.pop(value)) {
+				const uint32_t producer = value / valuesPerProducer;
+				REQUIRE(value % valuesPerProducer == nextValue[producer]);
+				nextValue[producer]++;
+				received++;
+			}
+		}
+
+		for (auto& producer: producers) {
+			producer.join();
+		}
+		CHECK(queue.empty());
+	}
+}
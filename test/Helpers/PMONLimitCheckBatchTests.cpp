@@ -0,0 +1,174 @@
+#include "Helpers/PMONLimitCheckBatch.hpp"
+#include <vector>
+#include "ServicePool.hpp"
+#include "catch2/catch_all.hpp"
+
+namespace {
+	/**
+	 * Collects the slots visited by forEachMarkedSlot
+	 */
+	template <size_t Capacity>
+	std::vector<std::pair<size_t, PMONBase::CheckingStatus>> markedSlots(const PMONLimitCheckBatch<Capacity>& batch) {
+		std::vector<std::pair<size_t, PMONBase::CheckingStatus>> slots;
+		batch.forEachMarkedSlot([&slots](size_t slot, PMONBase::CheckingStatus result) {
+			slots.emplace_back(slot, result);
+		});
+		return slots;
+	}
+} // namespace
+
+TEST_CASE("Batch limit checking") {
+	SECTION("Results against the limits") {
+		PMONLimitCheckBatch<4> batch;
+		std::vector<Parameter<double>> parameters = {Parameter<double>(-2), Parameter<double>(0.5), Parameter<double>(1.5)};
+		for (size_t slot = 0; slot < 3; slot++) {
+			CHECK(batch.add(-1, 1, parameters[slot]) == slot);
+			batch.setDue(slot, PMONBase::Unchecked, false);
+		}
+
+		CHECK(batch.evaluate() == 3);
+		CHECK(batch.getResult(0) == PMONBase::BelowLowLimit);
+		CHECK(batch.getResult(1) == PMONBase::WithinLimits);
+		CHECK(batch.getResult(2) == PMONBase::AboveHighLimit);
+		CHECK(batch.getValue(0) == -2);
+
+		// Values equal to the limits are within limits
+		parameters[0].setValue(-1);
+		parameters[2].setValue(1);
+		batch.setDue(0, PMONBase::Unchecked, false);
+		batch.setDue(2, PMONBase::Unchecked, false);
+		batch.evaluate();
+		CHECK(batch.getResult(0) == PMONBase::WithinLimits);
+		CHECK(batch.getResult(2) == PMONBase::WithinLimits);
+	}
+
+	SECTION("Values of every arithmetic type") {
+		PMONLimitCheckBatch<4> batch;
+		Parameter<int8_t> int8Parameter(-5);
+		Parameter<uint32_t> uint32Parameter(100000);
+		Parameter<float> floatParameter(2.5);
+		Parameter<bool> boolParameter(true);
+		batch.add(-10, 0, int8Parameter);
+		batch.add(0, 50000, uint32Parameter);
+		batch.add(2, 3, floatParameter);
+		batch.add(0, 0, boolParameter);
+		for (size_t slot = 0; slot < 4; slot++) {
+			batch.setDue(slot, PMONBase::Unchecked, false);
+		}
+
+		batch.evaluate();
+		CHECK(batch.getValue(0) == -5);
+		CHECK(batch.getValue(1) == 100000);
+		CHECK(batch.getValue(2) == 2.5);
+		CHECK(batch.getValue(3) == 1);
+		CHECK(batch.getResult(1) == PMONBase::AboveHighLimit);
+		CHECK(batch.getResult(3) == PMONBase::AboveHighLimit);
+	}
+
+	SECTION("Only due slots that changed or are pending are marked") {
+		PMONLimitCheckBatch<100> batch;
+		std::vector<Parameter<double>> parameters(70, Parameter<double>(5));
+		for (size_t slot = 0; slot < 70; slot++) {
+			batch.add(0, 10, parameters[slot]);
+			batch.setDue(slot, PMONBase::WithinLimits, false);
+		}
+		CHECK(batch.evaluate() == 0);
+		CHECK(markedSlots(batch).empty());
+
+		parameters[3].setValue(11);
+		parameters[40].setValue(-1);
+		parameters[50].setValue(-1);
+		for (size_t slot = 0; slot < 70; slot++) {
+			// Slot 50 is not due in this cycle, so it is not checked
+			if (slot != 50) {
+				batch.setDue(slot, PMONBase::WithinLimits, slot == 69);
+			}
+		}
+
+		CHECK(batch.evaluate() == 3);
+		auto slots = markedSlots(batch);
+		REQUIRE(slots.size() == 3);
+		CHECK(slots[0] == std::make_pair(size_t{3}, PMONBase::AboveHighLimit));
+		CHECK(slots[1] == std::make_pair(size_t{40}, PMONBase::BelowLowLimit));
+		CHECK(slots[2] == std::make_pair(size_t{69}, PMONBase::WithinLimits));
+
+		// Nothing is checked until slots are marked as due again
+		CHECK(batch.evaluate() == 0);
+	}
+
+	SECTION("Full batch") {
+		PMONLimitCheckBatch<2> batch;
+		Parameter<double> parameter(0);
+		batch.add(0, 1, parameter);
+		batch.add(0, 1, parameter);
+		CHECK(batch.full());
+		CHECK(batch.add(0, 1, parameter) == 2);
+		CHECK(batch.size() == 2);
+
+		batch.clear();
+		CHECK(batch.size() == 0);
+		CHECK(batch.evaluate() == 0);
+	}
+}
+
+namespace {
+	template <size_t Capacity>
+	void benchmarkLimitChecks() {
+		static PMONLimitCheckBatch<Capacity> batch;
+		batch.clear();
+
+		std::vector<PMONLimitCheck> definitions;
+		definitions.reserve(Capacity);
+		std::vector<Parameter<double>> parameters;
+		parameters.reserve(Capacity);
+		for (size_t i = 0; i < Capacity; i++) {
+			const double lowLimit = static_cast<double>(i % 100);
+			definitions.emplace_back(7, 1, lowLimit, 1, lowLimit + 50, 2);
+			parameters.emplace_back(lowLimit + 25);
+			batch.add(lowLimit, lowLimit + 50, parameters.back());
+		}
+
+		uint32_t cycle = 0;
+		auto updateValues = [&parameters, &cycle]() {
+			// A small fraction of the values leaves its limits on every cycle
+			cycle++;
+			for (size_t i = cycle % 64; i < Capacity; i += 64) {
+				parameters[i].setValue(parameters[i].getValue() + ((cycle % 2 == 0) ? 40 : -40));
+			}
+		};
+
+		BENCHMARK("Per-definition checks") {
+			updateValues();
+			uint32_t transitions = 0;
+			for (size_t i = 0; i < Capacity; i++) {
+				ParameterBase& parameter = parameters[i];
+				transitions += definitions[i].updateCheckingStatus(definitions[i].checkValue(parameter.getValueAsDouble()));
+			}
+			return transitions;
+		};
+
+		std::vector<PMONBase::CheckingStatus> statuses(Capacity, PMONBase::Unchecked);
+		BENCHMARK("Batch checks") {
+			updateValues();
+			for (size_t i = 0; i < Capacity; i++) {
+				batch.setDue(i, statuses[i], false);
+			}
+			uint32_t transitions = 0;
+			if (batch.evaluate() != 0) {
+				batch.forEachMarkedSlot([&statuses, &transitions](size_t slot, PMONBase::CheckingStatus result) {
+					statuses[slot] = result;
+					transitions++;
+				});
+			}
+			return transitions;
+		};
+	}
+} // namespace
+
+TEST_CASE("Batch limit checking of 1000 definitions", "[.][benchmark]") {
+	benchmarkLimitChecks<1000>();
+}
+
+TEST_CASE("Batch limit checking of 10000 definitions", "[.][benchmark]") {
+	benchmarkLimitChecks<10000>();
+}
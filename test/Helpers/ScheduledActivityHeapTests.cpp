@@ -0,0 +1,312 @@
+#include "Helpers/ScheduledActivityHeap.hpp"
+#include <vector>
+#include "catch2/catch_all.hpp"
+#include "etl/list.h"
+
+namespace {
+	struct TestActivity {
+		uint32_t requestReleaseTime = 0;
+		uint16_t requestID = 0;
+	};
+
+	template <size_t Capacity>
+	std::vector<uint32_t> releaseTimes(const ScheduledActivityHeap<TestActivity, Capacity>& schedule) {
+		std::vector<uint32_t> times;
+		for (auto slot: schedule.slotsInReleaseOrder()) {
+			times.push_back(schedule[slot].requestReleaseTime);
+		}
+		return times;
+	}
+} // namespace
+
+TEST_CASE("Scheduled activity heap") {
+	ScheduledActivityHeap<TestActivity, 8> schedule;
+
+	SECTION("The earliest activity is at the front") {
+		CHECK(schedule.front() == schedule.NoSlot);
+		CHECK(schedule.earliest() == schedule.NoSlot);
+		for (uint32_t time: {50, 20, 70, 10, 40}) {
+			schedule.insert({time, static_cast<uint16_t>(time / 10)});
+		}
+		CHECK(schedule.size() == 5);
+		CHECK(releaseTimes(schedule) == std::vector<uint32_t>{10, 20, 40, 50, 70});
+
+		std::vector<uint32_t> released;
+		while (not schedule.empty()) {
+			released.push_back(schedule[schedule.front()].requestReleaseTime);
+			schedule.erase(schedule.front());
+		}
+		CHECK(released == std::vector<uint32_t>{10, 20, 40, 50, 70});
+	}
+
+	SECTION("Activities with equal release times keep their insertion order") {
+		for (uint16_t id = 1; id <= 4; id++) {
+			schedule.insert({100, id});
+		}
+		for (uint16_t id = 1; id <= 4; id++) {
+			CHECK(schedule[schedule.front()].requestID == id);
+			schedule.erase(schedule.front());
+		}
+	}
+
+	SECTION("Find, erase and shift by request identifier") {
+		for (uint32_t time: {50, 20, 70, 10, 40}) {
+			schedule.insert({time, static_cast<uint16_t>(time / 10)});
+		}
+		// A second activity with an existing identifier
+		schedule.insert({90, 2});
+
+		CHECK(schedule.find(9) == schedule.NoSlot);
+		CHECK(schedule[schedule.find(2)].requestReleaseTime == 20);
+
+		schedule.erase(schedule.find(2));
+		CHECK(schedule[schedule.find(2)].requestReleaseTime == 90);
+		CHECK(releaseTimes(schedule) == std::vector<uint32_t>{10, 40, 50, 70, 90});
+
+		schedule.shift(schedule.find(7), -65);
+		schedule.shift(schedule.find(1), 100);
+		CHECK(releaseTimes(schedule) == std::vector<uint32_t>{5, 40, 50, 90, 110});
+		CHECK(schedule[schedule.front()].requestID == 7);
+
+		schedule.shiftAll(10);
+		CHECK(releaseTimes(schedule) == std::vector<uint32_t>{15, 50, 60, 100, 120});
+	}
+
+	SECTION("Parked activities are not at the front") {
+		for (uint32_t time: {50, 20, 70, 10}) {
+			schedule.insert({time, static_cast<uint16_t>(time / 10)});
+		}
+		const auto parkedSlot = schedule.insert({5, 0}, true);
+		CHECK(schedule.isParked(parkedSlot));
+		CHECK(schedule[schedule.front()].requestReleaseTime == 10);
+		CHECK(schedule.earliest() == parkedSlot);
+
+		schedule.park(schedule.find(1));
+		schedule.park(schedule.find(2));
+		CHECK(schedule[schedule.front()].requestReleaseTime == 50);
+		CHECK(schedule.size() == 5);
+		CHECK(releaseTimes(schedule) == std::vector<uint32_t>{5, 10, 20, 50, 70});
+
+		// Parked activities are still shifted and erased
+		schedule.shift(schedule.find(1), 100);
+		schedule.shiftAll(1);
+		schedule.erase(schedule.find(2));
+		CHECK(releaseTimes(schedule) == std::vector<uint32_t>{6, 51, 71, 111});
+
+		schedule.unpark(parkedSlot);
+		schedule.unpark(schedule.find(1));
+		CHECK(schedule[schedule.front()].requestReleaseTime == 6);
+
+		std::vector<uint32_t> released;
+		schedule.releaseDue(200, 10, [&released](auto, const TestActivity& activity) {
+			released.push_back(activity.requestReleaseTime);
+		});
+		CHECK(released == std::vector<uint32_t>{6, 51, 71, 111});
+		CHECK(schedule.empty());
+	}
+
+	SECTION("Activities in a time window") {
+		for (uint32_t time: {50, 20, 70, 10, 40, 20, 60}) {
+			schedule.insert({time, static_cast<uint16_t>(time / 10)});
+		}
+		schedule.park(schedule.find(4));
+		schedule.park(schedule.find(7));
+
+		auto timesInWindow = [&schedule](uint32_t startTime, uint32_t endTime) {
+			std::vector<uint32_t> times;
+			for (auto slot: schedule.scanReleasedUntil(startTime, endTime)) {
+				times.push_back(schedule[slot].requestReleaseTime);
+			}
+			return times;
+		};
+		CHECK(timesInWindow(20, 50) == std::vector<uint32_t>{20, 20, 40, 50});
+		CHECK(timesInWindow(21, 69) == std::vector<uint32_t>{40, 50, 60});
+		CHECK(timesInWindow(0, 100) == releaseTimes(schedule));
+		CHECK(timesInWindow(71, 100).empty());
+		CHECK(timesInWindow(0, 5).empty());
+	}
+
+	SECTION("Full schedule") {
+		for (uint16_t id = 0; id < 8; id++) {
+			CHECK(schedule.insert({id, id}) != schedule.NoSlot);
+		}
+		CHECK(schedule.full());
+		CHECK(schedule.insert({0, 0}) == schedule.NoSlot);
+
+		schedule.clear();
+		CHECK(schedule.empty());
+		CHECK(schedule.available() == 8);
+		CHECK(schedule.find(3) == schedule.NoSlot);
+	}
+}
+
+TEST_CASE("Release of due activities") {
+	ScheduledActivityHeap<TestActivity, 8> schedule;
+	for (uint32_t time: {50, 20, 70, 10, 40, 20}) {
+		schedule.insert({time, static_cast<uint16_t>(time / 10)});
+	}
+	std::vector<uint32_t> released;
+	auto release = [&released](auto, const TestActivity& activity) {
+		released.push_back(activity.requestReleaseTime);
+	};
+
+	SECTION("Due activities are released in order, up to the maximum") {
+		CHECK(schedule.releaseDue(5, 10, release) == 0);
+
+		CHECK(schedule.releaseDue(45, 3, release) == 3);
+		CHECK(released == std::vector<uint32_t>{10, 20, 20});
+
+		CHECK(schedule.releaseDue(45, 3, release) == 1);
+		CHECK(released == std::vector<uint32_t>{10, 20, 20, 40});
+		CHECK(releaseTimes(schedule) == std::vector<uint32_t>{50, 70});
+	}
+
+	SECTION("The schedule can be changed while activities are released") {
+		auto releaseAndReschedule = [&schedule, &released](auto, const TestActivity& activity) {
+			released.push_back(activity.requestReleaseTime);
+			if (activity.requestID == 1) {
+				schedule.insert({30, 3});
+				schedule.erase(schedule.find(4));
+			}
+		};
+		CHECK(schedule.releaseDue(45, 10, releaseAndReschedule) == 4);
+		CHECK(released == std::vector<uint32_t>{10, 20, 20, 30});
+		CHECK(releaseTimes(schedule) == std::vector<uint32_t>{50, 70});
+	}
+}
+
+namespace {
+	const size_t SimultaneousActivities = 1000;
+
+	/**
+	 * Simulates a scheduler that is called once per second, with 1000 activities due at the same second
+	 *
+	 * @return The number of seconds between the release time of the activities and the release of the last one
+	 */
+	uint32_t drainLatency(ScheduledActivityHeap<TestActivity, SimultaneousActivities>& schedule, size_t releaseBudget) {
+		schedule.clear();
+		for (uint16_t activity = 0; activity < SimultaneousActivities; activity++) {
+			schedule.insert({100, activity});
+		}
+
+		uint32_t currentTime = 100;
+		while (true) {
+			schedule.releaseDue(currentTime, releaseBudget, [](auto, const TestActivity&) {});
+			if (schedule.empty()) {
+				return currentTime - 100;
+			}
+			currentTime++;
+		}
+	}
+} // namespace
+
+TEST_CASE("Release of 1000 activities due at the same second") {
+	static ScheduledActivityHeap<TestActivity, SimultaneousActivities> schedule;
+
+	CHECK(drainLatency(schedule, 1) == 999);
+	CHECK(drainLatency(schedule, 8) == 124);
+	CHECK(drainLatency(schedule, SimultaneousActivities) == 0);
+}
+
+TEST_CASE("Drain latency of 1000 activities due at the same second", "[.][benchmark]") {
+	static ScheduledActivityHeap<TestActivity, SimultaneousActivities> schedule;
+
+	BENCHMARK("One activity per call") {
+		return drainLatency(schedule, 1);
+	};
+
+	BENCHMARK("Up to 8 activities per call") {
+		return drainLatency(schedule, 8);
+	};
+
+	BENCHMARK("All due activities in one call") {
+		return drainLatency(schedule, SimultaneousActivities);
+	};
+}
+
+namespace {
+	const size_t BenchmarkActivities = 10000;
+
+	uint32_t benchmarkReleaseTime(uint32_t activity) {
+		// Release times that are inserted out of order
+		return (activity * 7919) % 100000;
+	}
+} // namespace
+
+TEST_CASE("Scheduling of 10k activities", "[.][benchmark]") {
+	// The activities are inserted by TCs of 100 activities each, and the list is sorted after every TC
+	BENCHMARK("Sorted list: insert 100 TCs of 100 activities") {
+		static etl::list<TestActivity, BenchmarkActivities> schedule;
+		schedule.clear();
+		for (uint32_t activity = 0; activity < BenchmarkActivities; activity++) {
+			schedule.push_back({benchmarkReleaseTime(activity), static_cast<uint16_t>(activity)});
+			if (activity % 100 == 99) {
+				schedule.sort([](const TestActivity& leftSide, const TestActivity& rightSide) {
+					return leftSide.requestReleaseTime < rightSide.requestReleaseTime;
+				});
+			}
+		}
+		return schedule.size();
+	};
+
+	BENCHMARK("Heap: insert 100 TCs of 100 activities") {
+		static ScheduledActivityHeap<TestActivity, BenchmarkActivities> schedule;
+		schedule.clear();
+		for (uint32_t activity = 0; activity < BenchmarkActivities; activity++) {
+			schedule.insert({benchmarkReleaseTime(activity), static_cast<uint16_t>(activity)});
+		}
+		return schedule.size();
+	};
+
+	static ScheduledActivityHeap<TestActivity, BenchmarkActivities> schedule;
+	schedule.clear();
+	for (uint32_t activity = 0; activity < BenchmarkActivities; activity++) {
+		schedule.insert({benchmarkReleaseTime(activity), static_cast<uint16_t>(activity)});
+	}
+
+	BENCHMARK("Heap: time-shift 1000 activities by ID") {
+		for (uint16_t id = 0; id < 1000; id++) {
+			schedule.shift(schedule.find(id * 10), (id % 2 == 0) ? 50 : -50);
+		}
+		return schedule.front();
+	};
+
+	BENCHMARK("Heap: delete and insert again 1000 activities by ID") {
+		for (uint16_t id = 0; id < 1000; id++) {
+			const auto slot = schedule.find(id * 10);
+			const TestActivity activity = schedule[slot];
+			schedule.erase(slot);
+			schedule.insert(activity);
+		}
+		return schedule.front();
+	};
+}
+
+namespace {
+	const size_t LargeScheduleSize = 10000;
+} // namespace
+
+TEST_CASE("Reporting a time window of a 10k activity schedule", "[.][benchmark]") {
+	static ScheduledActivityHeap<TestActivity, LargeScheduleSize> schedule;
+	schedule.clear();
+	for (uint16_t activity = 0; activity < LargeScheduleSize; activity++) {
+		// Spread the activities over 10000 seconds, in an order that is not sorted
+		schedule.insert({static_cast<uint32_t>((activity * 7919U) % LargeScheduleSize), activity});
+	}
+
+	BENCHMARK("All the activities, sorted, filtered to the first 100 seconds") {
+		size_t matched = 0;
+		for (auto slot: schedule.slotsInReleaseOrder()) {
+			matched += (schedule[slot].requestReleaseTime < 100) ? 1 : 0;
+		}
+		return matched;
+	};
+
+	BENCHMARK("The first 100 seconds, scanned up to their end") {
+		return schedule.scanReleasedUntil(0U, 99U).size();
+	};
+
+	BENCHMARK("All the activities, scanned up to the last one") {
+		return schedule.scanReleasedUntil(0U, static_cast<uint32_t>(LargeScheduleSize)).size();
+	};
+}
@@ -0,0 +1,59 @@
+#include "Helpers/SlotGroups.hpp"
+#include <algorithm>
+#include <vector>
+#include "catch2/catch_all.hpp"
+
+namespace {
+	template <size_t Capacity, size_t Groups>
+	std::vector<uint16_t> slotsOf(const SlotGroups<Capacity, Groups>& groups, uint16_t group) {
+		std::vector<uint16_t> slots;
+		groups.forEach(group, [&slots](auto slot) {
+			slots.push_back(slot);
+		});
+		std::sort(slots.begin(), slots.end());
+		return slots;
+	}
+} // namespace
+
+TEST_CASE("Slot groups") {
+	SlotGroups<8, 3> groups;
+	for (uint16_t slot = 0; slot < 8; slot++) {
+		groups.add(slot, slot % 3);
+	}
+	CHECK(groups.size(0) == 3);
+	CHECK(groups.size(1) == 3);
+	CHECK(groups.size(2) == 2);
+	CHECK(slotsOf(groups, 1) == std::vector<uint16_t>{1, 4, 7});
+
+	SECTION("Removing slots") {
+		// The first, a middle and the last slot of a group
+		groups.remove(6);
+		groups.remove(3);
+		CHECK(slotsOf(groups, 0) == std::vector<uint16_t>{0});
+		groups.remove(0);
+		CHECK(slotsOf(groups, 0).empty());
+		CHECK(groups.size(0) == 0);
+
+		// A removed slot can be added to another group
+		groups.add(3, 2);
+		CHECK(slotsOf(groups, 2) == std::vector<uint16_t>{2, 3, 5});
+		CHECK(slotsOf(groups, 1) == std::vector<uint16_t>{1, 4, 7});
+	}
+
+	SECTION("Removing every slot of a group while visiting it") {
+		groups.forEach(1, [&groups](auto slot) {
+			groups.remove(slot);
+		});
+		CHECK(groups.size(1) == 0);
+		CHECK(slotsOf(groups, 1).empty());
+		CHECK(slotsOf(groups, 0) == std::vector<uint16_t>{0, 3, 6});
+	}
+
+	SECTION("Clearing all groups") {
+		groups.clear();
+		for (uint16_t group = 0; group < 3; group++) {
+			CHECK(groups.size(group) == 0);
+			CHECK(slotsOf(groups, group).empty());
+		}
+	}
+}
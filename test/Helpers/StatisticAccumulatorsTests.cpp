@@ -0,0 +1,106 @@
+#include "Helpers/StatisticAccumulators.hpp"
+#include <limits>
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Rolling window of statistics") {
+	SECTION("Disabled window ignores samples") {
+		StatisticWindow window;
+		CHECK(not window.isEnabled());
+		window.update(5);
+		CHECK(window.getSampleCount() == 0);
+		CHECK(window.getMax() == 0);
+	}
+
+	SECTION("Partially filled window") {
+		StatisticWindow window;
+		window.setSize(4);
+		window.update(3);
+		window.update(-1);
+		window.update(4);
+
+		CHECK(window.getSampleCount() == 3);
+		CHECK(window.getMax() == 4);
+		CHECK(window.getMin() == -1);
+		CHECK(window.getMean() == Catch::Approx(2));
+	}
+
+	SECTION("Oldest samples are dropped from a full window") {
+		StatisticWindow window;
+		window.setSize(3);
+		for (double value: {10.0, 20.0, 1.0, 2.0, 3.0}) {
+			window.update(value);
+		}
+
+		CHECK(window.getSampleCount() == 3);
+		CHECK(window.getMax() == 3);
+		CHECK(window.getMin() == 1);
+		CHECK(window.getMean() == Catch::Approx(2));
+	}
+
+	SECTION("Size is clamped and reset keeps the size") {
+		StatisticWindow window;
+		window.setSize(ECSSMaxStatisticWindowSize + 10);
+		CHECK(window.getSize() == ECSSMaxStatisticWindowSize);
+
+		window.update(1);
+		window.reset();
+		CHECK(window.getSampleCount() == 0);
+		CHECK(window.getSize() == ECSSMaxStatisticWindowSize);
+	}
+}
+
+TEST_CASE("Histogram percentiles of statistics") {
+	SECTION("Disabled histogram ignores samples") {
+		StatisticHistogram histogram;
+		CHECK(not histogram.isEnabled());
+		histogram.update(5);
+		CHECK(histogram.getSampleCount() == 0);
+		CHECK(histogram.getPercentile(50) == 0);
+	}
+
+	SECTION("Uniform samples") {
+		StatisticHistogram histogram;
+		histogram.setRange(0, 100);
+		for (int value = 0; value < 100; value++) {
+			histogram.update(value + 0.5);
+		}
+
+		double binWidth = 100.0 / ECSSStatisticHistogramBins;
+		CHECK(histogram.getSampleCount() == 100);
+		CHECK(histogram.getPercentile(50) == Catch::Approx(50).margin(binWidth));
+		CHECK(histogram.getPercentile(95) == Catch::Approx(95).margin(binWidth));
+		CHECK(histogram.getPercentile(99) == Catch::Approx(99).margin(binWidth));
+	}
+
+	SECTION("Samples outside of the range are clamped") {
+		StatisticHistogram histogram;
+		histogram.setRange(-10, 10);
+		histogram.update(-1000);
+		histogram.update(1000);
+		histogram.update(1000);
+
+		CHECK(histogram.getSampleCount() == 3);
+		CHECK(histogram.getPercentile(0) >= -10);
+		CHECK(histogram.getPercentile(100) <= 10);
+		CHECK(histogram.getPercentile(99) > 9);
+	}
+
+	SECTION("A full bin halves every bin and keeps the shape") {
+		StatisticHistogram histogram;
+		histogram.setRange(0, 100);
+		double binWidth = 100.0 / ECSSStatisticHistogramBins;
+
+		// A quarter of the samples are 25 and the rest are 75, so both bins pass 65535 samples
+		for (uint32_t i = 0; i < 100000; i++) {
+			histogram.update(25);
+			histogram.update(75);
+			histogram.update(75);
+			histogram.update(75);
+		}
+
+		CHECK(histogram.getSampleCount() < 2U * std::numeric_limits<uint16_t>::max());
+		CHECK(histogram.getPercentile(10) == Catch::Approx(25).margin(binWidth));
+		CHECK(histogram.getPercentile(50) == Catch::Approx(75).margin(binWidth));
+		CHECK(histogram.getPercentile(95) == Catch::Approx(75).margin(binWidth));
+	}
+}
@@ -82,3 +82,78 @@ TEST_CASE("Reset statistics") {
 		REQUIRE(stat.statisticsAreInitialized());
 	}
 }
+
+TEST_CASE("Statistics updating with a known sample time") {
+	SECTION("Single values") {
+		Statistic stat;
+		Time::DefaultCUC firstTime(100);
+		Time::DefaultCUC secondTime(200);
+
+		stat.updateStatistics(3.0, firstTime);
+		stat.updateStatistics(5.0, secondTime);
+		stat.updateStatistics(1.0, secondTime);
+		stat.updateStatistics(4.0, firstTime);
+
+		CHECK(stat.max == 5.0);
+		CHECK(stat.timeOfMaxValue == secondTime);
+		CHECK(stat.min == 1.0);
+		CHECK(stat.timeOfMinValue == secondTime);
+		CHECK(stat.mean == Catch::Approx(3.25));
+		CHECK(stat.sampleCounter == 4);
+	}
+
+	SECTION("Block of values gives the same result as single values") {
+		double values[11] = {8.3001, 2.3, 6.4, 1.1, 8.35, 3.4, 6, 8.31, 4.7, 1.09, 7.2};
+		Time::DefaultCUC sampleTime(300);
+		Statistic singleStat;
+		Statistic blockStat;
+		for (auto& value: values) {
+			singleStat.updateStatistics(value, sampleTime);
+		}
+		blockStat.updateStatistics(1.5, sampleTime);
+		singleStat.updateStatistics(1.5, sampleTime);
+		blockStat.updateStatistics(etl::span<const double>(values, 11), sampleTime);
+
+		CHECK(blockStat.max == singleStat.max);
+		CHECK(blockStat.min == singleStat.min);
+		CHECK(blockStat.timeOfMaxValue == sampleTime);
+		CHECK(blockStat.timeOfMinValue == sampleTime);
+		CHECK(blockStat.mean == Catch::Approx(singleStat.mean));
+		CHECK(blockStat.sumOfSquares == Catch::Approx(singleStat.sumOfSquares));
+		CHECK(blockStat.sampleCounter == 12);
+	}
+
+	SECTION("Empty block leaves the statistics untouched") {
+		Statistic stat;
+		stat.updateStatistics(etl::span<const double>(), Time::DefaultCUC(0));
+		CHECK(stat.statisticsAreInitialized());
+	}
+}
+
+TEST_CASE("Statistics updating throughput", "[.][benchmark]") {
+	double values[1024];
+	for (size_t i = 0; i < 1024; i++) {
+		values[i] = static_cast<double>((i * 7919) % 1031) - 512.0;
+	}
+	Statistic stat;
+
+	BENCHMARK("1024 values, fetching the time on new extrema") {
+		for (auto& value: values) {
+			stat.updateStatistics(value);
+		}
+		stat.resetStatistics();
+	};
+
+	BENCHMARK("1024 values, with a single sample time") {
+		Time::DefaultCUC sampleTime = TimeGetter::getCurrentTimeDefaultCUC();
+		for (auto& value: values) {
+			stat.updateStatistics(value, sampleTime);
+		}
+		stat.resetStatistics();
+	};
+
+	BENCHMARK("1024 values, as a single block") {
+		stat.updateStatistics(etl::span<const double>(values, 1024), TimeGetter::getCurrentTimeDefaultCUC());
+		stat.resetStatistics();
+	};
+}
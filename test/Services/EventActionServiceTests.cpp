@@ -531,4 +531,160 @@ TEST_CASE("Execute a TC request", "[service][st19]") {
 		CHECK(report.read<ParameterId>() == 2);
 		CHECK(report.readUint32() == 10);
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("Event-action requests are decoded when they are added", "[service][st19]") {
+	Message addDefinitions(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+	addDefinitions.appendUint8(2);
+
+	Message action(ParameterService::ServiceType, ParameterService::MessageType::ReportParameterValues, Message::TC, 1);
+	action.appendUint16(1);
+	action.append<ParameterId>(2);
+	addDefinitions.append<ApplicationProcessId>(0);
+	addDefinitions.append<EventDefinitionId>(1);
+	addDefinitions.appendMessage(action, ECSSTCRequestStringSize);
+
+	addDefinitions.append<ApplicationProcessId>(0);
+	addDefinitions.append<EventDefinitionId>(2);
+	addDefinitions.appendFixedString(String<ECSSTCRequestStringSize>("123"));
+	MessageParser::execute(addDefinitions);
+
+	SECTION("Valid request") {
+		const auto& definition = eventActionService.eventActionDefinitionMap.find(1)->second;
+		CHECK(definition.actionHeaderIsValid);
+		CHECK(definition.actionServiceType == ParameterService::ServiceType);
+		CHECK(definition.actionMessageType == ParameterService::MessageType::ReportParameterValues);
+
+		Message parsed = MessageParser::parseECSSTC(definition.request);
+		Message built;
+		definition.buildAction(built);
+		CHECK(built.packetType == Message::TC);
+		CHECK(built.serviceType == parsed.serviceType);
+		CHECK(built.messageType == parsed.messageType);
+		CHECK(built.sourceId == parsed.sourceId);
+		CHECK(built.applicationId == parsed.applicationId);
+		CHECK(built.dataSize == parsed.dataSize);
+		CHECK(std::equal(built.data, built.data + built.dataSize, parsed.data));
+		CHECK(built.readUint16() == 1);
+		CHECK(built.read<ParameterId>() == 2);
+		CHECK(ServiceTests::hasNoErrors());
+	}
+
+	SECTION("Invalid request") {
+		// The request is only rejected when the event occurs, as it was before it was decoded in advance
+		const auto& definition = eventActionService.eventActionDefinitionMap.find(2)->second;
+		CHECK_FALSE(definition.actionHeaderIsValid);
+		CHECK(ServiceTests::hasNoErrors());
+
+		Message built;
+		definition.buildAction(built);
+		CHECK(ServiceTests::thrownError(ErrorHandler::UnacceptableMessage));
+	}
+
+	eventActionService.eventActionDefinitionMap.clear();
+}
+
+TEST_CASE("Event-triggered actions are deferred", "[service][st19]") {
+	const EventDefinitionId eventID = EventReportService::AssertionFail;
+
+	Message action(ParameterService::ServiceType, ParameterService::MessageType::ReportParameterValues, Message::TC, 1);
+	action.appendUint16(1);
+	action.append<ParameterId>(0);
+
+	Message addDefinition(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+	addDefinition.appendUint8(1);
+	addDefinition.append<ApplicationProcessId>(0);
+	addDefinition.append<EventDefinitionId>(eventID);
+	addDefinition.appendMessage(action, ECSSTCRequestStringSize);
+	MessageParser::execute(addDefinition);
+
+	Message enableDefinition(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
+	enableDefinition.appendUint8(1);
+	enableDefinition.append<ApplicationProcessId>(0);
+	enableDefinition.append<EventDefinitionId>(eventID);
+	MessageParser::execute(enableDefinition);
+
+	SECTION("The action runs after the event report") {
+		Services.eventReport.lowSeverityAnomalyReport(EventReportService::AssertionFail, "");
+		REQUIRE(ServiceTests::count() == 1);
+		CHECK(ServiceTests::get(0).serviceType == EventReportService::ServiceType);
+		CHECK(eventActionService.getPendingActionCount() == 1);
+
+		eventActionService.executePendingActions();
+		REQUIRE(ServiceTests::count() == 2);
+		CHECK(ServiceTests::get(1).serviceType == ParameterService::ServiceType);
+		CHECK(ServiceTests::get(1).messageType == ParameterService::MessageType::ParameterValuesReport);
+		CHECK(eventActionService.getPendingActionCount() == 0);
+	}
+
+	SECTION("Events without an enabled definition are not queued") {
+		Services.eventReport.lowSeverityAnomalyReport(EventReportService::WWDGReset, "");
+		CHECK(eventActionService.getPendingActionCount() == 0);
+
+		eventActionService.setEventActionFunctionStatus(false);
+		Services.eventReport.lowSeverityAnomalyReport(EventReportService::AssertionFail, "");
+		CHECK(eventActionService.getPendingActionCount() == 0);
+		eventActionService.setEventActionFunctionStatus(true);
+	}
+
+	SECTION("Actions are dropped when the queue is full") {
+		for (uint8_t event = 0; event < ECSSEventActionQueueSize + 2; event++) {
+			eventActionService.queueAction(eventID);
+		}
+		CHECK(eventActionService.getPendingActionCount() == ECSSEventActionQueueSize);
+		CHECK(eventActionService.getDroppedActionCount() == 2);
+
+		eventActionService.executePendingActions();
+		CHECK(ServiceTests::count() == ECSSEventActionQueueSize);
+		CHECK(eventActionService.getPendingActionCount() == 0);
+	}
+
+	CHECK(ServiceTests::hasNoErrors());
+	eventActionService.eventActionDefinitionMap.clear();
+}
+
+TEST_CASE("Event-action execution", "[.][benchmark]") {
+	const uint16_t numberOfDefinitions = 100;
+	Message action(EventActionService::ServiceType, EventActionService::MessageType::EnableEventActionFunction, Message::TC, 0);
+
+	for (EventDefinitionId eventDefinitionID = 0; eventDefinitionID < numberOfDefinitions; eventDefinitionID++) {
+		Message addDefinition(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+		addDefinition.appendUint8(1);
+		addDefinition.append<ApplicationProcessId>(0);
+		addDefinition.append<EventDefinitionId>(eventDefinitionID * 3);
+		addDefinition.appendMessage(action, ECSSTCRequestStringSize);
+		MessageParser::execute(addDefinition);
+	}
+	Message enableAllDefinitions(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
+	enableAllDefinitions.appendUint8(0);
+	MessageParser::execute(enableAllDefinitions);
+	REQUIRE(eventActionService.eventActionDefinitionMap.size() == numberOfDefinitions);
+
+	auto& definition = eventActionService.eventActionDefinitionMap.begin()->second;
+	BENCHMARK("Action decoded on every event") {
+		return MessageParser::parseECSSTC(definition.request).dataSize;
+	};
+
+	BENCHMARK("Action decoded when added") {
+		Message action;
+		definition.buildAction(action);
+		return action.dataSize;
+	};
+
+	BENCHMARK("Informative event report to action execution") {
+		Services.eventReport.informativeEventReport(EventReportService::InformativeUnknownEvent, "");
+		eventActionService.executePendingActions();
+		// Drops the stored TM[5,1], so that the sent messages do not pile up between runs
+		ServiceTests::resetErrors();
+		return eventActionService.getPendingActionCount();
+	};
+
+	BENCHMARK("100k events, one in three with an action") {
+		for (uint32_t event = 0; event < 100000; event++) {
+			eventActionService.executeAction(event % (numberOfDefinitions * 3));
+		}
+		return eventActionService.getEventActionFunctionStatus();
+	};
+
+	CHECK(ServiceTests::hasNoErrors());
+	eventActionService.eventActionDefinitionMap.clear();
+}
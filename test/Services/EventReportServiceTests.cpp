@@ -2,6 +2,8 @@
 #include <Services/EventReportService.hpp>
 #include <catch2/catch_all.hpp>
 #include <cstring>
+#include <thread>
+#include <vector>
 #include "ServiceTests.hpp"
 
 EventReportService& eventReportService = Services.eventReport;
@@ -166,3 +168,212 @@ TEST_CASE("List of observables 6.5.6", "[service][st05]") {
 	CHECK(eventReportService.lastMediumSeverityReportID == 5);
 	CHECK(eventReportService.lastHighSeverityReportID == 65535);
 }
+
+TEST_CASE("Event reports beyond the burst are suppressed and coalesced", "[service][st05]") {
+	const String<64> eventReportData = "HelloWorld";
+	eventReportService.setRateLimit(EventReportService::LowSeverityAnomalyReport, 2, 1000);
+	eventReportService.updateRateLimits(0);
+
+	for (int i = 0; i < 10; i++) {
+		eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	}
+	CHECK(ServiceTests::count() == 2);
+	CHECK(eventReportService.lowSeverityEventCount == 10);
+	CHECK(eventReportService.lowSeverityReportCount == 2);
+	CHECK(eventReportService.lowSeveritySuppressedCount == 8);
+
+	// No token has been regained yet
+	CHECK(eventReportService.updateRateLimits(500) == 500);
+	CHECK(ServiceTests::count() == 2);
+
+	eventReportService.updateRateLimits(1000);
+	REQUIRE(ServiceTests::count() == 3);
+	CHECK(eventReportService.coalescedReportCount == 1);
+
+	Message report = ServiceTests::get(2);
+	CHECK(report.messageType == EventReportService::MessageType::LowSeverityAnomalyReport);
+	CHECK(report.read<EventDefinitionId>() == EventReportService::SuppressedEventOccurrences);
+	CHECK(report.read<EventDefinitionId>() == EventReportService::LowSeverityUnknownEvent);
+	CHECK(report.readUint16() == 8);
+	const auto firstTime = report.readDefaultCUCTimeStamp();
+	CHECK(report.readDefaultCUCTimeStamp() >= firstTime);
+
+	// The coalesced report spent the regained token
+	eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	CHECK(ServiceTests::count() == 3);
+	CHECK(eventReportService.lowSeveritySuppressedCount == 9);
+}
+
+TEST_CASE("Event report tokens are regained over time", "[service][st05]") {
+	const String<64> eventReportData = "HelloWorld";
+	eventReportService.setRateLimit(EventReportService::LowSeverityAnomalyReport, 2, 1000);
+	eventReportService.updateRateLimits(0);
+
+	eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	CHECK(eventReportService.updateRateLimits(100) == 900);
+
+	eventReportService.updateRateLimits(2500);
+	eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	CHECK(ServiceTests::count() == 4);
+	CHECK(eventReportService.lowSeveritySuppressedCount == 0);
+}
+
+TEST_CASE("Event reports are rate limited per event and severity", "[service][st05]") {
+	const String<64> eventReportData = "HelloWorld";
+	eventReportService.setRateLimit(EventReportService::LowSeverityAnomalyReport, 2, 1000);
+	eventReportService.updateRateLimits(0);
+
+	for (int i = 0; i < 3; i++) {
+		eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+		eventReportService.lowSeverityAnomalyReport(EventReportService::AssertionFail, eventReportData);
+		eventReportService.highSeverityAnomalyReport(EventReportService::HighSeverityUnknownEvent, eventReportData);
+	}
+	CHECK(eventReportService.lowSeverityReportCount == 4);
+	CHECK(eventReportService.lowSeveritySuppressedCount == 2);
+	CHECK(eventReportService.highSeverityReportCount == 3);
+	CHECK(eventReportService.highSeveritySuppressedCount == 0);
+}
+
+TEST_CASE("Events are reported with their configured report type", "[service][st05]") {
+	const String<64> eventReportData = "HelloWorld";
+	CHECK(eventReportService.getEventReportType(EventReportService::InformativeUnknownEvent) ==
+	      EventReportService::InformativeEventReport);
+	CHECK(eventReportService.getEventReportType(EventReportService::MediumSeverityUnknownEvent) ==
+	      EventReportService::MediumSeverityAnomalyReport);
+
+	eventReportService.eventReport(EventReportService::HighSeverityUnknownEvent, eventReportData);
+	REQUIRE(ServiceTests::hasOneMessage());
+	CHECK(ServiceTests::get(0).messageType == EventReportService::HighSeverityAnomalyReport);
+
+	CHECK(eventReportService.setEventReportType(EventReportService::WWDGReset, EventReportService::MediumSeverityAnomalyReport));
+	eventReportService.eventReport(EventReportService::WWDGReset, eventReportData);
+	REQUIRE(ServiceTests::count() == 2);
+	CHECK(ServiceTests::get(1).messageType == EventReportService::MediumSeverityAnomalyReport);
+	CHECK(eventReportService.lastMediumSeverityReportID == EventReportService::WWDGReset);
+
+	CHECK(not eventReportService.setEventReportType(EventReportService::WWDGReset, EventReportService::EnableReportGenerationOfEvents));
+	CHECK(not eventReportService.setEventReportType(EventReportService::SuppressedEventOccurrences,
+	                                                EventReportService::LowSeverityAnomalyReport));
+	CHECK(eventReportService.getEventReportType(EventReportService::WWDGReset) == EventReportService::MediumSeverityAnomalyReport);
+
+	eventReportService.eventReport(EventReportService::SuppressedEventOccurrences, eventReportData);
+	CHECK(ServiceTests::count() == 2);
+}
+
+TEST_CASE("Event report storm", "[.][benchmark]") {
+	const String<64> eventReportData = "HelloWorld";
+
+	BENCHMARK("10k low severity reports without rate limiting") {
+		eventReportService.setRateLimit(EventReportService::LowSeverityAnomalyReport, 0, 0);
+		for (int i = 0; i < 10000; i++) {
+			eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+		}
+		ServiceTests::reset();
+		return eventReportService.lowSeverityReportCount;
+	};
+
+	BENCHMARK("10k low severity reports with rate limiting") {
+		eventReportService.setRateLimit(EventReportService::LowSeverityAnomalyReport, 10, 1000);
+		for (int i = 0; i < 10000; i++) {
+			eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+		}
+		eventReportService.updateRateLimits(1000);
+		ServiceTests::reset();
+		return eventReportService.lowSeverityReportCount;
+	};
+}
+
+TEST_CASE("Raised events are reported in batches", "[service][st05]") {
+	const String<64> eventReportData = "HelloWorld";
+	CHECK(eventReportService.raiseEvent(EventReportService::LowSeverityUnknownEvent,
+	                                    EventReportService::LowSeverityAnomalyReport, eventReportData));
+	CHECK(eventReportService.raiseEvent(EventReportService::HighSeverityUnknownEvent,
+	                                    EventReportService::HighSeverityAnomalyReport, eventReportData));
+	CHECK(eventReportService.raiseEvent(EventReportService::InformativeUnknownEvent,
+	                                    EventReportService::InformativeEventReport, eventReportData));
+	CHECK(eventReportService.getRaisedEventCount() == 3);
+	CHECK(ServiceTests::count() == 0);
+
+	CHECK(eventReportService.processRaisedEvents(2) == 2);
+	REQUIRE(ServiceTests::count() == 2);
+	CHECK(eventReportService.lowSeverityReportCount == 1);
+	CHECK(eventReportService.highSeverityReportCount == 1);
+
+	Message report = ServiceTests::get(0);
+	CHECK(report.messageType == EventReportService::MessageType::LowSeverityAnomalyReport);
+	CHECK(report.read<EventDefinitionId>() == EventReportService::LowSeverityUnknownEvent);
+	char checkString[255];
+	report.readCString(checkString, 10);
+	CHECK(strcmp(checkString, "HelloWorld") == 0);
+	CHECK(ServiceTests::get(1).messageType == EventReportService::MessageType::HighSeverityAnomalyReport);
+
+	CHECK(eventReportService.processRaisedEvents() == 1);
+	CHECK(ServiceTests::get(2).messageType == EventReportService::MessageType::InformativeEventReport);
+	CHECK(eventReportService.getRaisedEventCount() == 0);
+
+	SECTION("Events are dropped when the queue is full") {
+		for (size_t i = 0; i < ECSSRaisedEventQueueSize; i++) {
+			CHECK(eventReportService.raiseEvent(EventReportService::MCUStart, EventReportService::InformativeEventReport, ""));
+		}
+		CHECK_FALSE(eventReportService.raiseEvent(EventReportService::MCUStart, EventReportService::InformativeEventReport, ""));
+		CHECK(eventReportService.getDroppedRaisedEventCount() == 1);
+		CHECK(eventReportService.processRaisedEvents() == ECSSRaisedEventQueueSize);
+	}
+
+	SECTION("Events with an invalid report type or ID are rejected") {
+		const auto droppedEvents = eventReportService.getDroppedRaisedEventCount();
+		CHECK_FALSE(eventReportService.raiseEvent(EventReportService::MCUStart,
+		                                          EventReportService::EnableReportGenerationOfEvents, eventReportData));
+		CHECK_FALSE(eventReportService.raiseEvent(EventReportService::MCUStart,
+		                                          static_cast<EventReportService::MessageType>(0), eventReportData));
+		CHECK_FALSE(eventReportService.raiseEvent(static_cast<EventReportService::Event>(EventReportService::numberOfEvents),
+		                                          EventReportService::InformativeEventReport, eventReportData));
+		CHECK_FALSE(eventReportService.raiseEvent(static_cast<EventReportService::Event>(UINT16_MAX),
+		                                          EventReportService::HighSeverityAnomalyReport, eventReportData));
+
+		CHECK(eventReportService.getRaisedEventCount() == 0);
+		CHECK(eventReportService.getDroppedRaisedEventCount() == droppedEvents);
+		CHECK(eventReportService.processRaisedEvents() == 0);
+		CHECK(ServiceTests::count() == 3);
+	}
+}
+
+TEST_CASE("Raised events from concurrent producers", "[.][benchmark]") {
+	const uint32_t producerCount = 4;
+	const uint32_t eventsPerProducer = 2500;
+
+	BENCHMARK("4 producers raising 10k events") {
+		std::atomic<bool> start{false};
+		std::vector<std::thread> producers;
+		for (uint32_t producer = 0; producer < producerCount; producer++) {
+			producers.emplace_back([&start]() {
+				while (not start.load()) {
+					std::this_thread::yield();
+				}
+				for (uint32_t event = 0; event < eventsPerProducer; event++) {
+					while (not eventReportService.raiseEvent(EventReportService::LowSeverityUnknownEvent,
+					                                         EventReportService::LowSeverityAnomalyReport, "")) {
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+
+		start.store(true);
+		size_t reportedEvents = 0;
+		while (reportedEvents < producerCount * eventsPerProducer) {
+			const size_t batch = eventReportService.processRaisedEvents();
+			if (batch == 0) {
+				std::this_thread::yield();
+			}
+			reportedEvents += batch;
+		}
+		for (auto& producer: producers) {
+			producer.join();
+		}
+		ServiceTests::resetErrors();
+		return reportedEvents;
+	};
+}
@@ -5,6 +5,10 @@
 #include <etl/String.hpp>
 #include <filesystem>
 #include <fstream>
+#include <set>
+#include <string>
+#include "Helpers/FilepathValidators.hpp"
+#include "Platform/x86/Helpers/FilesystemRoot.hpp"
 #include "ServiceTests.hpp"
 
 namespace fs = std::filesystem;
@@ -277,3 +281,477 @@ TEST_CASE("File attributes report TM[23,4]", "[service][st23]") {
 
 	fs::remove_all(fs::temp_directory_path() / "st23");
 }
+
+Message fileContentRequest(FileManagementService::MessageType messageType, const char* fileName) {
+	Message request(FileManagementService::ServiceType, messageType, Message::TC, 0);
+	request.appendOctetString(String<64>("st23"));
+	request.appendOctetString(String<64>(fileName));
+	return request;
+}
+
+Message writeFileContentRequest(const char* fileName, uint32_t offset, const uint8_t* data, uint16_t dataLength) {
+	Message request = fileContentRequest(FileManagementService::WriteFileContent, fileName);
+	request.appendUint32(offset);
+	request.appendOctetString(String<FileManagementService::MaxFileChunkSize>(data, dataLength));
+	return request;
+}
+
+Message readFileContentRequest(const char* fileName, uint32_t offset, uint32_t length) {
+	Message request = fileContentRequest(FileManagementService::ReadFileContent, fileName);
+	request.appendUint32(offset);
+	request.appendUint32(length);
+	return request;
+}
+
+/**
+ * Checks a TM[23,27] report of a file in the "st23" repository, whose byte at position N is N % 251
+ */
+void checkFileContentReport(Message& report, const char* fileName, uint32_t offset, uint16_t length) {
+	CHECK(report.messageType == FileManagementService::FileContentReport);
+	CHECK(report.readOctetString<64>() == String<64>("st23"));
+	CHECK(report.readOctetString<64>() == String<64>(fileName));
+	CHECK(report.readUint32() == offset);
+	REQUIRE(report.readUint16() == length);
+	for (uint32_t position = offset; position < offset + length; position++) {
+		CHECK(report.readUint8() == position % 251);
+	}
+}
+
+TEST_CASE("Write and read the content of a file TC[23,25], TC[23,26], TM[23,27]", "[service][st23]") {
+	fs::current_path(fs::temp_directory_path());
+	fs::create_directories("st23/directory");
+	std::ofstream(fs::temp_directory_path() / "st23/content").close();
+
+	uint8_t data[600];
+	for (uint16_t position = 0; position < 600; position++) {
+		data[position] = position % 251;
+	}
+
+	SECTION("Chunked writes and reads") {
+		Message write1 = writeFileContentRequest("content", 0, data, 300);
+		MessageParser::execute(write1);
+		Message write2 = writeFileContentRequest("content", 300, data + 300, 300);
+		MessageParser::execute(write2);
+		CHECK(ServiceTests::count() == 0);
+		CHECK(fs::file_size("st23/content") == 600);
+
+		Message readAll = readFileContentRequest("content", 0, 0);
+		MessageParser::execute(readAll);
+		CHECK(ServiceTests::countErrors() == 0);
+		REQUIRE(ServiceTests::count() == 2);
+		checkFileContentReport(ServiceTests::get(0), "content", 0, FileManagementService::MaxFileChunkSize);
+		checkFileContentReport(ServiceTests::get(1), "content", FileManagementService::MaxFileChunkSize,
+		                       600 - FileManagementService::MaxFileChunkSize);
+		ServiceTests::reset();
+
+		Message readPart = readFileContentRequest("content", 100, 10);
+		MessageParser::execute(readPart);
+		REQUIRE(ServiceTests::count() == 1);
+		checkFileContentReport(ServiceTests::get(0), "content", 100, 10);
+		ServiceTests::reset();
+
+		Message readPastTheEnd = readFileContentRequest("content", 590, 100);
+		MessageParser::execute(readPastTheEnd);
+		REQUIRE(ServiceTests::count() == 1);
+		checkFileContentReport(ServiceTests::get(0), "content", 590, 10);
+	}
+
+	SECTION("Reading an empty file reports no content") {
+		Message readAll = readFileContentRequest("content", 0, 0);
+		MessageParser::execute(readAll);
+		REQUIRE(ServiceTests::count() == 1);
+		checkFileContentReport(ServiceTests::get(0), "content", 0, 0);
+	}
+
+	SECTION("Writes to a locked file are rejected") {
+		Message write = writeFileContentRequest("content", 0, data, 100);
+		MessageParser::execute(write);
+		REQUIRE(ServiceTests::count() == 0);
+
+		Filesystem::lockFile("st23/content");
+		REQUIRE(Filesystem::getFileLockStatus("st23/content") == Filesystem::FileLockStatus::Locked);
+
+		Message writeLocked = writeFileContentRequest("content", 50, data + 300, 100);
+		MessageParser::execute(writeLocked);
+		CHECK(ServiceTests::countErrors() == 1);
+		CHECK(ServiceTests::thrownError(ErrorHandler::AttemptedWriteOnLockedFile));
+
+		Filesystem::unlockFile("st23/content");
+		CHECK(fs::file_size("st23/content") == 100);
+		std::ifstream file(fs::temp_directory_path() / "st23/content", std::ios::binary);
+		for (uint16_t position = 0; position < 100; position++) {
+			CHECK(file.get() == data[position]);
+		}
+	}
+
+	SECTION("Errors") {
+		Message readAfterTheEnd = readFileContentRequest("content", 1, 0);
+		MessageParser::execute(readAfterTheEnd);
+		CHECK(ServiceTests::thrownError(ErrorHandler::FileOffsetIsOutOfBounds));
+
+		Message writeTooLarge = writeFileContentRequest("content", FileManagementService::MaxPossibleFileSizeBytes - 10, data, 11);
+		MessageParser::execute(writeTooLarge);
+		CHECK(ServiceTests::thrownError(ErrorHandler::SizeOfFileIsOutOfBounds));
+
+		Message writeMissing = writeFileContentRequest("missing", 0, data, 10);
+		MessageParser::execute(writeMissing);
+		CHECK(ServiceTests::thrownError(ErrorHandler::ObjectDoesNotExist));
+
+		Message readDirectory = readFileContentRequest("directory", 0, 0);
+		MessageParser::execute(readDirectory);
+		CHECK(ServiceTests::thrownError(ErrorHandler::AttemptedContentAccessOnDirectory));
+
+		Message readWildcard = readFileContentRequest("content*", 0, 0);
+		MessageParser::execute(readWildcard);
+		CHECK(ServiceTests::thrownError(ErrorHandler::UnexpectedWildcard));
+
+		CHECK(ServiceTests::countErrors() == 5);
+		CHECK(fs::file_size("st23/content") == 0);
+	}
+
+	fs::remove_all(fs::temp_directory_path() / "st23");
+}
+
+TEST_CASE("Transfer a file to a packet store TC[23,28]", "[service][st23]") {
+	fs::current_path(fs::temp_directory_path());
+	fs::create_directories("st23");
+	{
+		std::ofstream file(fs::temp_directory_path() / "st23/transfer");
+		for (uint16_t position = 0; position < 1100; position++) {
+			file.put(static_cast<char>(position % 251));
+		}
+	}
+
+	uint8_t packetStoreIdBytes[ECSSPacketStoreIdSize] = "ps1";
+	const String<ECSSPacketStoreIdSize> packetStoreId(packetStoreIdBytes);
+	PacketStore newPacketStore;
+	newPacketStore.sizeInBytes = 2048;
+	newPacketStore.storageStatus = true;
+	Services.storageAndRetrieval.addPacketStore(packetStoreId, newPacketStore);
+	auto& packetStore = Services.storageAndRetrieval.getPacketStore(packetStoreId);
+	auto& storedTelemetryPackets = packetStore.storedTelemetryPackets;
+
+	Message transfer = fileContentRequest(FileManagementService::TransferFileToPacketStore, "transfer");
+	transfer.appendString(packetStoreId);
+
+	SECTION("The file is stored in chunks") {
+		MessageParser::execute(transfer);
+		CHECK(ServiceTests::count() == 0);
+		REQUIRE(storedTelemetryPackets.size() == 3);
+		checkFileContentReport(storedTelemetryPackets[0].second, "transfer", 0, 512);
+		checkFileContentReport(storedTelemetryPackets[1].second, "transfer", 512, 512);
+		checkFileContentReport(storedTelemetryPackets[2].second, "transfer", 1024, 76);
+	}
+
+	SECTION("The packet store does not have room for the file") {
+		while (storedTelemetryPackets.available() > 2) {
+			storedTelemetryPackets.push_back({0, Message()});
+		}
+		MessageParser::execute(transfer);
+		CHECK(ServiceTests::thrownError(ErrorHandler::PacketStoreCannotHoldFile));
+		CHECK(storedTelemetryPackets.available() == 2);
+	}
+
+	SECTION("The packet store does not have room for the bytes of the file") {
+		packetStore.sizeInBytes = 1100;
+		MessageParser::execute(transfer);
+		CHECK(ServiceTests::thrownError(ErrorHandler::PacketStoreCannotHoldFile));
+		CHECK(storedTelemetryPackets.empty());
+	}
+
+	SECTION("The storage of the packet store is disabled") {
+		packetStore.storageStatus = false;
+		MessageParser::execute(transfer);
+		CHECK(ServiceTests::thrownError(ErrorHandler::PacketStoreStorageIsDisabled));
+		CHECK(storedTelemetryPackets.empty());
+	}
+
+	SECTION("The packet store does not exist") {
+		uint8_t missingPacketStoreIdBytes[ECSSPacketStoreIdSize] = "ps2";
+		Message transferToMissing = fileContentRequest(FileManagementService::TransferFileToPacketStore, "transfer");
+		transferToMissing.appendString(String<ECSSPacketStoreIdSize>(missingPacketStoreIdBytes));
+		MessageParser::execute(transferToMissing);
+		CHECK(ServiceTests::thrownError(ErrorHandler::NonExistingPacketStore));
+	}
+
+	Services.storageAndRetrieval.resetPacketStores();
+	fs::remove_all(fs::temp_directory_path() / "st23");
+}
+
+TEST_CASE("ST[23] file content throughput", "[.][benchmark][st23]") {
+	const fs::path root = fs::exists("/dev/shm") ? fs::path("/dev/shm") : fs::temp_directory_path();
+	fs::create_directories(root / "st23");
+	Filesystem::setRootDirectory(root.c_str());
+	constexpr uint32_t FileSize = 1024 * 1024;
+	{
+		std::ofstream file(root / "st23/throughput");
+		for (uint32_t position = 0; position < FileSize; position++) {
+			file.put(static_cast<char>(position % 251));
+		}
+	}
+
+	const Message read = readFileContentRequest("throughput", 0, 0);
+
+	BENCHMARK("Downlink 1 MiB as TM[23,27] reports") {
+		Message message = read;
+		MessageParser::execute(message);
+		const uint64_t reports = ServiceTests::count();
+		ServiceTests::reset();
+		return reports;
+	};
+
+	uint8_t chunk[FileManagementService::MaxFileChunkSize] = {};
+	const size_t chunks = FileManagementService::MaxPossibleFileSizeBytes / FileManagementService::MaxFileChunkSize;
+
+	BENCHMARK("Upload 4 KiB in TC[23,25] chunks") {
+		for (size_t index = 0; index < chunks; index++) {
+			Message message = writeFileContentRequest("throughput", index * FileManagementService::MaxFileChunkSize, chunk,
+			                                          FileManagementService::MaxFileChunkSize);
+			MessageParser::execute(message);
+		}
+		return ServiceTests::count();
+	};
+
+	Filesystem::setRootDirectory("");
+	fs::remove_all(root / "st23");
+}
+
+TEST_CASE("Wildcard pattern matching", "[st23]") {
+	using FilepathValidators::matchesWildcardPattern;
+
+	CHECK(matchesWildcardPattern("file.txt", "file.txt"));
+	CHECK(not matchesWildcardPattern("file.txt", "file.log"));
+	CHECK(matchesWildcardPattern("*.txt", "file.txt"));
+	CHECK(matchesWildcardPattern("*.txt", "directory/file.txt"));
+	CHECK(not matchesWildcardPattern("*.txt", "file.txt.log"));
+	CHECK(matchesWildcardPattern("directory/*", "directory/file"));
+	CHECK(matchesWildcardPattern("a*b*c", "aXbYbZc"));
+	CHECK(matchesWildcardPattern("a*b", "ab"));
+	CHECK(not matchesWildcardPattern("a*c", "ab"));
+	CHECK(matchesWildcardPattern("*", ""));
+	CHECK(not matchesWildcardPattern("", "file"));
+}
+
+/**
+ * Reads all the objects of TM[23,8] reports, checking that each report starts with the provided paths
+ */
+std::set<std::string> readFoundFiles(const char* repositoryPath, const char* searchPattern) {
+	std::set<std::string> foundFiles;
+	for (uint64_t index = 0; index < ServiceTests::count(); index++) {
+		Message& report = ServiceTests::get(index);
+		CHECK(report.messageType == FileManagementService::FoundFileReport);
+		CHECK(report.readOctetString<64>() == String<64>(repositoryPath));
+		CHECK(report.readOctetString<64>() == String<64>(searchPattern));
+		uint16_t files = report.readUint16();
+		for (uint16_t file = 0; file < files; file++) {
+			auto path = report.readOctetString<Filesystem::ObjectPathSize>();
+			foundFiles.emplace(path.data(), path.size());
+		}
+	}
+	return foundFiles;
+}
+
+Message findFilesRequest(const char* repositoryPath, const char* searchPattern) {
+	Message request(FileManagementService::ServiceType, FileManagementService::FindFile, Message::TC, 0);
+	request.appendOctetString(String<64>(repositoryPath));
+	request.appendOctetString(String<64>(searchPattern));
+	return request;
+}
+
+TEST_CASE("Find files TC[23,7], TM[23,8]", "[service][st23]") {
+	fs::current_path(fs::temp_directory_path());
+	fs::create_directories("st23/directory/subdirectory");
+	for (const char* file: {"st23/a.txt", "st23/b.log", "st23/directory/c.txt", "st23/directory/subdirectory/d.txt"}) {
+		std::ofstream(fs::temp_directory_path() / file).close();
+	}
+
+	SECTION("Files are found at any depth") {
+		Message request = findFilesRequest("st23", "*.txt");
+		MessageParser::execute(request);
+		CHECK(ServiceTests::countErrors() == 0);
+		REQUIRE(ServiceTests::hasOneMessage());
+		CHECK(readFoundFiles("st23", "*.txt") ==
+		      std::set<std::string>{"a.txt", "directory/c.txt", "directory/subdirectory/d.txt"});
+	}
+
+	SECTION("Directories are not reported") {
+		Message request = findFilesRequest("st23", "directory*");
+		MessageParser::execute(request);
+		CHECK(readFoundFiles("st23", "directory*") ==
+		      std::set<std::string>{"directory/c.txt", "directory/subdirectory/d.txt"});
+	}
+
+	SECTION("An empty search is reported") {
+		Message request = findFilesRequest("st23", "*.bin");
+		MessageParser::execute(request);
+		REQUIRE(ServiceTests::hasOneMessage());
+		CHECK(readFoundFiles("st23", "*.bin").empty());
+	}
+
+	SECTION("The search does not go deeper than the maximum depth") {
+		fs::path deepDirectory = "st23";
+		for (uint8_t depth = 0; depth <= FileManagementService::MaxSearchDepth; depth++) {
+			deepDirectory /= "d";
+			fs::create_directory(deepDirectory);
+			std::ofstream(deepDirectory / "deep.bin").close();
+		}
+
+		Message request = findFilesRequest("st23", "*.bin");
+		MessageParser::execute(request);
+		CHECK(readFoundFiles("st23", "*.bin").size() == FileManagementService::MaxSearchDepth);
+	}
+
+	SECTION("The found files are split in multiple reports") {
+		const std::string prefix(60, 'f');
+		for (uint8_t file = 0; file < 40; file++) {
+			std::ofstream(fs::temp_directory_path() / "st23" / (prefix + std::to_string(file))).close();
+		}
+
+		Message request = findFilesRequest("st23", "fff*");
+		MessageParser::execute(request);
+		CHECK(ServiceTests::count() > 1);
+		CHECK(readFoundFiles("st23", "fff*").size() == 40);
+	}
+
+	SECTION("Errors") {
+		Message wildcardRepository = findFilesRequest("st*", "*");
+		MessageParser::execute(wildcardRepository);
+		CHECK(ServiceTests::thrownError(ErrorHandler::UnexpectedWildcard));
+
+		Message missingRepository = findFilesRequest("st23/missing", "*");
+		MessageParser::execute(missingRepository);
+		CHECK(ServiceTests::thrownError(ErrorHandler::ObjectDoesNotExist));
+
+		Message fileRepository = findFilesRequest("st23/a.txt", "*");
+		MessageParser::execute(fileRepository);
+		CHECK(ServiceTests::thrownError(ErrorHandler::RepositoryPathLeadsToFile));
+
+		CHECK(ServiceTests::countErrors() == 3);
+	}
+
+	fs::remove_all(fs::temp_directory_path() / "st23");
+}
+
+TEST_CASE("Report a directory summary TC[23,12], TM[23,13]", "[service][st23]") {
+	fs::current_path(fs::temp_directory_path());
+	fs::create_directories("st23/directory/subdirectory");
+	std::ofstream(fs::temp_directory_path() / "st23/directory/file").close();
+
+	Message request(FileManagementService::ServiceType, FileManagementService::ReportSummaryDirectory, Message::TC, 0);
+	request.appendOctetString(String<64>("st23"));
+	request.appendOctetString(String<64>("directory"));
+
+	SECTION("Objects of the directory") {
+		MessageParser::execute(request);
+		CHECK(ServiceTests::countErrors() == 0);
+		REQUIRE(ServiceTests::hasOneMessage());
+
+		Message& report = ServiceTests::get(0);
+		CHECK(report.messageType == FileManagementService::SummaryDirectoryReport);
+		CHECK(report.readOctetString<64>() == String<64>("st23"));
+		CHECK(report.readOctetString<64>() == String<64>("directory"));
+		REQUIRE(report.readUint16() == 2);
+
+		std::set<std::pair<uint8_t, std::string>> objects;
+		for (uint8_t object = 0; object < 2; object++) {
+			uint8_t type = report.readEnum8();
+			auto name = report.readOctetString<64>();
+			objects.emplace(type, std::string(name.data(), name.size()));
+		}
+		CHECK(objects == std::set<std::pair<uint8_t, std::string>>{
+		                     {static_cast<uint8_t>(Filesystem::NodeType::File), "file"},
+		                     {static_cast<uint8_t>(Filesystem::NodeType::Directory), "subdirectory"}});
+	}
+
+	SECTION("Errors") {
+		Message fileSummary(FileManagementService::ServiceType, FileManagementService::ReportSummaryDirectory,
+		                    Message::TC, 0);
+		fileSummary.appendOctetString(String<64>("st23/directory"));
+		fileSummary.appendOctetString(String<64>("file"));
+		MessageParser::execute(fileSummary);
+		CHECK(ServiceTests::thrownError(ErrorHandler::AttemptedSummaryOfFile));
+
+		Message missingSummary(FileManagementService::ServiceType, FileManagementService::ReportSummaryDirectory,
+		                       Message::TC, 0);
+		missingSummary.appendOctetString(String<64>("st23"));
+		missingSummary.appendOctetString(String<64>("missing"));
+		MessageParser::execute(missingSummary);
+		CHECK(ServiceTests::thrownError(ErrorHandler::ObjectDoesNotExist));
+
+		CHECK(ServiceTests::countErrors() == 2);
+	}
+
+	fs::remove_all(fs::temp_directory_path() / "st23");
+}
+
+TEST_CASE("Find files in a tree of 100k files", "[.][benchmark][st23]") {
+	const fs::path root = fs::exists("/dev/shm") ? fs::path("/dev/shm") : fs::temp_directory_path();
+	fs::create_directories(root / "st23");
+	Filesystem::setRootDirectory(root.c_str());
+	for (uint16_t directory = 0; directory < 100; directory++) {
+		const fs::path directoryPath = root / "st23" / ("directory" + std::to_string(directory));
+		fs::create_directory(directoryPath);
+		for (uint16_t file = 0; file < 1000; file++) {
+			std::ofstream(directoryPath / ("file" + std::to_string(file) + ".log")).close();
+		}
+	}
+
+	const Message fewMatches = findFilesRequest("st23", "directory4*/file99*");
+	const Message allMatches = findFilesRequest("st23", "*.log");
+
+	BENCHMARK("Search matching 121 of the files") {
+		Message message = fewMatches;
+		MessageParser::execute(message);
+		const uint64_t reports = ServiceTests::count();
+		ServiceTests::reset();
+		return reports;
+	};
+
+	BENCHMARK("Search stopping at MaxReportedObjects files") {
+		Message message = allMatches;
+		MessageParser::execute(message);
+		const uint64_t reports = ServiceTests::count();
+		ServiceTests::reset();
+		return reports;
+	};
+
+	Filesystem::setRootDirectory("");
+	fs::remove_all(root / "st23");
+}
+
+TEST_CASE("ST[23] operations per second on tmpfs", "[.][benchmark][st23]") {
+	const fs::path root = fs::exists("/dev/shm") ? fs::path("/dev/shm") : fs::temp_directory_path();
+	fs::create_directories(root / "st23_benchmark");
+	Filesystem::setRootDirectory(root.c_str());
+
+	auto fileMessage = [](FileManagementService::MessageType messageType) {
+		Message message(FileManagementService::ServiceType, messageType, Message::TC, 0);
+		message.appendOctetString(String<64>("st23_benchmark"));
+		message.appendOctetString(String<64>("file"));
+		if (messageType == FileManagementService::CreateFile) {
+			message.appendUint32(100);
+			message.appendBoolean(false);
+		}
+		return message;
+	};
+	const Message create = fileMessage(FileManagementService::CreateFile);
+	const Message report = fileMessage(FileManagementService::ReportAttributes);
+	const Message remove = fileMessage(FileManagementService::DeleteFile);
+
+	BENCHMARK("1000 x TC[23,1], TC[23,3], TC[23,2]") {
+		for (uint16_t operation = 0; operation < 1000; operation++) {
+			Message message = create;
+			MessageParser::execute(message);
+			message = report;
+			MessageParser::execute(message);
+			message = remove;
+			MessageParser::execute(message);
+		}
+		const bool failed = ServiceTests::countErrors() != 0;
+		ServiceTests::reset();
+		return failed;
+	};
+
+	Filesystem::setRootDirectory("");
+	fs::remove_all(root / "st23_benchmark");
+}
@@ -3,9 +3,16 @@
 #include <catch2/catch_all.hpp>
 #include <cstring>
 #include <etl/String.hpp>
+#include <filesystem>
+#include <fstream>
 #include "ECSS_Definitions.hpp"
+#include "Helpers/PacketStore.hpp"
+#include "MessageParser.hpp"
+#include "Platform/x86/Helpers/FilesystemRoot.hpp"
 #include "ServiceTests.hpp"
 
+namespace fs = std::filesystem;
+
 LargePacketTransferService& lPT = Services.largePacketTransferService;
 
 TEST_CASE("First Downlink Part Report TM[13,1]", "[service][st13]") {
@@ -53,39 +60,276 @@ TEST_CASE("Last Downlink Part Report TM[13,3]", "[service][st13]") {
 	CHECK(string.compare(a) == 0);
 }
 
-TEST_CASE("First Uplink Part TC[13,9]", "[service][st13]") {
-	String<256> string = "12345678";
-	CHECK(string.compare(lPT.firstUplinkPart(string)) == 0);
-}
-
-TEST_CASE("Intermediate Uplink Part TC[13,10]", "[service][st13]") {
-	String<256> string = "12345678";
-	CHECK(string.compare(lPT.intermediateUplinkPart(string)) == 0);
-}
-
-TEST_CASE("Last Uplink Part TC[13,11]", "[service][st13]") {
-	String<256> string = "12345678";
-	CHECK(string.compare(lPT.lastUplinkPart(string)) == 0);
-}
-
-TEST_CASE("Split function", "[no][service]") {
+TEST_CASE("Split function", "[service][st13]") {
 	Message message(13, 0, Message::TC, 0);
 	for (uint16_t i = 0; i < 800; i++) {
-		message.appendUint8(UINT8_MAX);
+		message.appendUint8(i % UINT8_MAX);
 	}
 	LargeMessageTransactionId largeMessageTransactionIdentifier = 1;
 	lPT.split(message, largeMessageTransactionIdentifier);
-	Message message5(13, 0, Message::TC, 0);
+	REQUIRE(ServiceTests::count() == 4);
+	CHECK(ServiceTests::get(0).messageType == LargePacketTransferService::MessageType::FirstDownlinkPartReport);
+	CHECK(ServiceTests::get(1).messageType == LargePacketTransferService::MessageType::InternalDownlinkPartReport);
+	CHECK(ServiceTests::get(2).messageType == LargePacketTransferService::MessageType::InternalDownlinkPartReport);
+	CHECK(ServiceTests::get(3).messageType == LargePacketTransferService::MessageType::LastDownlinkPartReport);
 
+	Message message5(13, 0, Message::TC, 0);
 	for (int i = 0; i < 4; i++) {
 		PartSequenceNum partSequenceNumber = i;
 		CHECK(largeMessageTransactionIdentifier == ServiceTests::get(i).read<LargeMessageTransactionId>());
 		CHECK(partSequenceNumber == ServiceTests::get(i).read<PartSequenceNum>());
-		CHECK(ECSSMaxFixedOctetStringSize == ServiceTests::get(i).readUint16());
-		for (int j = 0; j < 256; j++) {
+		// The last part only carries the remaining 32 bytes
+		const uint16_t partSize = (i < 3) ? ECSSMaxFixedOctetStringSize : 32;
+		CHECK(partSize == ServiceTests::get(i).readUint16());
+		for (int j = 0; j < partSize; j++) {
 			message5.appendUint8(ServiceTests::get(i).readUint8());
 		}
 	}
 
 	CHECK(message.bytesEqualWith(message5));
 }
+
+namespace {
+	std::vector<uint8_t> testPayload(size_t size) {
+		std::vector<uint8_t> payload(size);
+		for (size_t i = 0; i < size; i++) {
+			payload[i] = i % 251;
+		}
+		return payload;
+	}
+
+	/**
+	 * Joins the parts of a large packet that has been downlinked, checking their order
+	 */
+	std::vector<uint8_t> downlinkedPayload(LargeMessageTransactionId largeMessageTransactionIdentifier) {
+		std::vector<uint8_t> payload;
+		for (uint64_t i = 0; i < ServiceTests::count(); i++) {
+			Message& report = ServiceTests::get(i);
+			CHECK(report.serviceType == LargePacketTransferService::ServiceType);
+			CHECK(report.read<LargeMessageTransactionId>() == largeMessageTransactionIdentifier);
+			CHECK(report.read<PartSequenceNum>() == i);
+			const uint16_t partSize = report.readUint16();
+			payload.insert(payload.end(), report.data + report.readPosition, report.data + report.readPosition + partSize);
+		}
+		return payload;
+	}
+
+	Message uplinkPart(MessageTypeNum messageType, LargeMessageTransactionId largeMessageTransactionIdentifier,
+	                   PartSequenceNum partSequenceNumber, const std::vector<uint8_t>& payload) {
+		Message message(LargePacketTransferService::ServiceType, messageType, Message::TC, 0);
+		message.append<LargeMessageTransactionId>(largeMessageTransactionIdentifier);
+		message.append<PartSequenceNum>(partSequenceNumber);
+		const size_t start = partSequenceNumber * LargePacketTransferService::PartSize;
+		const auto partSize = static_cast<uint16_t>(std::min(payload.size() - start, size_t{LargePacketTransferService::PartSize}));
+		message.appendOctetString(String<ECSSMaxFixedOctetStringSize>(payload.data() + start, partSize));
+		return message;
+	}
+} // namespace
+
+TEST_CASE("Split payloads of any size", "[service][st13]") {
+	SECTION("A payload that fits in a single part") {
+		auto payload = testPayload(100);
+		CHECK(lPT.split(etl::span<const uint8_t>(payload.data(), payload.size()), 7));
+		REQUIRE(ServiceTests::hasOneMessage());
+		CHECK(ServiceTests::get(0).messageType == LargePacketTransferService::MessageType::LastDownlinkPartReport);
+		CHECK(downlinkedPayload(7) == payload);
+	}
+
+	SECTION("A payload of whole parts") {
+		auto payload = testPayload(3 * LargePacketTransferService::PartSize);
+		CHECK(lPT.split(etl::span<const uint8_t>(payload.data(), payload.size()), 7));
+		CHECK(ServiceTests::count() == 3);
+		CHECK(downlinkedPayload(7) == payload);
+	}
+
+	SECTION("A payload larger than any message") {
+		auto payload = testPayload(100000);
+		CHECK(lPT.split(etl::span<const uint8_t>(payload.data(), payload.size()), 7));
+		CHECK(ServiceTests::count() == 391);
+		CHECK(downlinkedPayload(7) == payload);
+	}
+
+	SECTION("An empty payload") {
+		CHECK(lPT.split(etl::span<const uint8_t>(), 7));
+		CHECK(ServiceTests::count() == 0);
+	}
+
+	ServiceTests::reset();
+}
+
+TEST_CASE("Split a file", "[service][st13]") {
+	const fs::path root = fs::temp_directory_path() / "st13";
+	fs::create_directories(root);
+	Filesystem::setRootDirectory(root.c_str());
+	auto payload = testPayload(1000);
+	std::ofstream(root / "file", std::ios::binary).write(reinterpret_cast<const char*>(payload.data()), payload.size());
+
+	CHECK(lPT.splitFile("file", 3));
+	CHECK(ServiceTests::count() == 4);
+	CHECK(downlinkedPayload(3) == payload);
+
+	ServiceTests::reset();
+	CHECK_FALSE(lPT.splitFile("missing", 3));
+	CHECK(ServiceTests::count() == 0);
+
+	Filesystem::setRootDirectory("");
+	fs::remove_all(root);
+}
+
+TEST_CASE("Split a packet store", "[service][st13]") {
+	PacketStore packetStore;
+	Message first(3, 25, Message::TM, 1);
+	first.appendUint32(0xAABBCCDD);
+	Message second(5, 1, Message::TM, 1);
+	for (uint16_t i = 0; i < 500; i++) {
+		second.appendUint8(i);
+	}
+	packetStore.storedTelemetryPackets.push_back({10, first});
+	packetStore.storedTelemetryPackets.push_back({20, second});
+
+	CHECK(lPT.splitPacketStore(packetStore, 4));
+	CHECK(ServiceTests::count() == 3);
+
+	std::vector<uint8_t> expected = {0, 0, 0, 10, 3, 25, 0, 4, 0xAA, 0xBB, 0xCC, 0xDD, 0, 0, 0, 20, 5, 1, 0x01, 0xF4};
+	expected.insert(expected.end(), second.data, second.data + second.dataSize);
+	CHECK(downlinkedPayload(4) == expected);
+
+	ServiceTests::reset();
+}
+
+TEST_CASE("Uplink parts TC[13,9], TC[13,10], TC[13,11]", "[service][st13]") {
+	using MessageType = LargePacketTransferService::MessageType;
+	auto payload = testPayload(700);
+
+	SECTION("Parts in order") {
+		Message firstPart = uplinkPart(MessageType::FirstUplinkPart, 1, 0, payload);
+		Message intermediatePart = uplinkPart(MessageType::IntermediateUplinkPart, 1, 1, payload);
+		Message lastPart = uplinkPart(MessageType::LastUplinkPart, 1, 2, payload);
+		MessageParser::execute(firstPart);
+		MessageParser::execute(intermediatePart);
+		CHECK(ServiceTests::countLargePackets() == 0);
+		MessageParser::execute(lastPart);
+
+		REQUIRE(ServiceTests::countLargePackets() == 1);
+		CHECK(ServiceTests::getLargePacket(0) == payload);
+		CHECK(ServiceTests::count() == 0);
+	}
+
+	SECTION("Parts out of order and repeated") {
+		Message lastPart = uplinkPart(MessageType::LastUplinkPart, 1, 2, payload);
+		Message firstPart = uplinkPart(MessageType::FirstUplinkPart, 1, 0, payload);
+		Message repeatedPart = firstPart;
+		Message intermediatePart = uplinkPart(MessageType::IntermediateUplinkPart, 1, 1, payload);
+		MessageParser::execute(lastPart);
+		MessageParser::execute(firstPart);
+		MessageParser::execute(repeatedPart);
+		MessageParser::execute(intermediatePart);
+
+		REQUIRE(ServiceTests::countLargePackets() == 1);
+		CHECK(ServiceTests::getLargePacket(0) == payload);
+	}
+
+	SECTION("Downlinked parts can be uplinked back") {
+		CHECK(lPT.split(etl::span<const uint8_t>(payload.data(), payload.size()), 5));
+		const uint64_t parts = ServiceTests::count();
+		for (uint64_t i = 0; i < parts; i++) {
+			Message report = ServiceTests::get(parts - 1 - i);
+			Message message(LargePacketTransferService::ServiceType, report.messageType + 8, Message::TC, 0);
+			std::copy(report.data, report.data + report.dataSize, message.data);
+			message.dataSize = report.dataSize;
+			MessageParser::execute(message);
+		}
+
+		REQUIRE(ServiceTests::countLargePackets() == 1);
+		CHECK(ServiceTests::getLargePacket(0) == payload);
+	}
+
+	SECTION("Invalid parts") {
+		Message intermediatePart = uplinkPart(MessageType::IntermediateUplinkPart, 1, 0, payload);
+		MessageParser::execute(intermediatePart);
+		CHECK(ServiceTests::thrownError(ErrorHandler::InvalidLargePacketPart));
+
+		Message shortPart = uplinkPart(MessageType::FirstUplinkPart, 1, 0, testPayload(10));
+		MessageParser::execute(shortPart);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidLargePacketPart) == 2);
+		CHECK(ServiceTests::countLargePackets() == 0);
+	}
+
+	SECTION("Packets that the platform refuses fail the last request") {
+		ServiceTests::rejectLargePackets();
+		Message firstPart = uplinkPart(MessageType::FirstUplinkPart, 1, 0, payload);
+		Message intermediatePart = uplinkPart(MessageType::IntermediateUplinkPart, 1, 1, payload);
+		Message lastPart = uplinkPart(MessageType::LastUplinkPart, 1, 2, payload);
+		MessageParser::execute(firstPart);
+		MessageParser::execute(intermediatePart);
+		CHECK(ServiceTests::countErrors() == 0);
+		MessageParser::execute(lastPart);
+
+		CHECK(ServiceTests::countErrors() == 1);
+		CHECK(ServiceTests::thrownError(ErrorHandler::LargePacketNotAccepted));
+		CHECK(ServiceTests::countLargePackets() == 0);
+	}
+
+	SECTION("Too many transactions") {
+		for (LargeMessageTransactionId transaction = 0; transaction <= ECSSMaxLargePacketTransactions; transaction++) {
+			Message firstPart = uplinkPart(MessageType::FirstUplinkPart, transaction, 0, payload);
+			MessageParser::execute(firstPart);
+		}
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::MaxLargePacketTransactionsReached) == 1);
+	}
+
+	ServiceTests::reset();
+}
+
+TEST_CASE("ST[13] segmentation and reassembly throughput", "[.][benchmark][st13]") {
+	const auto payload = testPayload(1024 * 1024);
+
+	BENCHMARK("Segment 1 MiB into TM[13,1], TM[13,2] and TM[13,3] parts") {
+		lPT.split(etl::span<const uint8_t>(payload.data(), payload.size()), 1);
+		const uint64_t parts = ServiceTests::count();
+		ServiceTests::resetErrors();
+		return parts;
+	};
+
+	// The parts of a 4 KiB packet, with the last part sent first and the rest in reverse order
+	const auto packet = testPayload(ECSSMaxLargePacketSize);
+	constexpr PartSequenceNum Parts = ECSSMaxLargePacketSize / LargePacketTransferService::PartSize;
+	std::vector<Message> parts;
+	parts.push_back(uplinkPart(LargePacketTransferService::LastUplinkPart, 1, Parts - 1, packet));
+	for (PartSequenceNum part = Parts - 2; part > 0; part--) {
+		parts.push_back(uplinkPart(LargePacketTransferService::IntermediateUplinkPart, 1, part, packet));
+	}
+	parts.push_back(uplinkPart(LargePacketTransferService::FirstUplinkPart, 1, 0, packet));
+
+	BENCHMARK("Reassemble 4 KiB from 16 parts out of order") {
+		for (const auto& part: parts) {
+			Message message = part;
+			lPT.execute(message);
+		}
+		const uint64_t packets = ServiceTests::countLargePackets();
+		ServiceTests::resetErrors();
+		return packets;
+	};
+
+	LargePacketTransferService::Reassembler reassembler;
+	const Time::DefaultCUC now;
+	size_t reassembledBytes = 0;
+
+	BENCHMARK("Reassemble 1 MiB as 4 KiB packets, without TC parsing") {
+		for (size_t offset = 0; offset < payload.size(); offset += ECSSMaxLargePacketSize) {
+			for (PartSequenceNum part = 0; part < Parts; part++) {
+				using PartType = LargePacketTransferService::Reassembler::PartType;
+				const PartType partType = (part == 0) ? PartType::First : ((part == Parts - 1) ? PartType::Last : PartType::Intermediate);
+				const etl::span<const uint8_t> data(payload.data() + offset + part * LargePacketTransferService::PartSize,
+				                                    LargePacketTransferService::PartSize);
+				reassembler.receivePart(1, part, partType, data, now,
+				                        [&reassembledBytes](LargeMessageTransactionId, etl::span<const uint8_t> completed) {
+					                        reassembledBytes += completed.size();
+				                        });
+			}
+		}
+		return reassembledBytes;
+	};
+
+	ServiceTests::reset();
+}
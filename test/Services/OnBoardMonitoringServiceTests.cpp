@@ -4,6 +4,8 @@
 #include <catch2/catch_all.hpp>
 #include <etl/String.hpp>
 #include <etl/array.h>
+#include <limits>
+#include <vector>
 #include "ServiceTests.hpp"
 
 OnBoardMonitoringService& onBoardMonitoringService = Services.onBoardMonitoringService;
@@ -191,3 +193,612 @@ TEST_CASE("Delete all Parameter Monitoring Definitions") {
 		Services.reset();
 	}
 }
+
+/**
+ * Appends a limit check definition to a TC[12,5] or TC[12,7]
+ */
+void appendLimitCheckDefinition(Message& request, PMONId id, ParameterId parameterId, float lowLimit, float highLimit) {
+	request.append<PMONId>(id);
+	request.append<ParameterId>(parameterId);
+	request.appendUint32(1000);
+	request.appendUint16(3);
+	request.appendUint8(PMONBase::LimitCheck);
+	request.appendFloat(lowLimit);
+	request.append<EventDefinitionId>(1);
+	request.appendFloat(highLimit);
+	request.append<EventDefinitionId>(2);
+}
+
+/**
+ * Appends a delta check definition to a TC[12,5] or TC[12,7]
+ */
+void appendDeltaCheckDefinition(Message& request, PMONId id, ParameterId parameterId) {
+	request.append<PMONId>(id);
+	request.append<ParameterId>(parameterId);
+	request.appendUint32(0);
+	request.appendUint16(2);
+	request.appendUint8(PMONBase::DeltaCheck);
+	request.appendUint16(4);
+	request.appendFloat(-1);
+	request.append<EventDefinitionId>(3);
+	request.appendFloat(1);
+	request.append<EventDefinitionId>(4);
+}
+
+/**
+ * @return The copy of a fixture that is owned by the service
+ */
+template <typename PMONCheck>
+PMONCheck& storedPMONDefinition(PMONId PMONId) {
+	return static_cast<PMONCheck&>(onBoardMonitoringService.getPMONDefinition(PMONId).get());
+}
+
+/**
+ * The parameter monitored by all the fixtures
+ */
+Parameter<uint8_t>& monitoredParameter() {
+	return static_cast<Parameter<uint8_t>&>(Services.parameterManagement.getParameter(7)->get());
+}
+
+TEST_CASE("Check pending Parameter Monitoring Definitions") {
+	initialiseParameterMonitoringDefinitions();
+	onBoardMonitoringService.parameterMonitoringFunctionStatus = true;
+	// Keep the check transitions buffered, so that only the event reports are generated
+	onBoardMonitoringService.maximumTransitionReportingDelay = 100;
+	onBoardMonitoringService.getPMONDefinition(0).get().monitoringEnabled = false;
+	const uint8_t initialValue = monitoredParameter().getValue();
+
+	SECTION("Limit check with repetitions") {
+		auto& definition = storedPMONDefinition<PMONLimitCheck>(1);
+		definition.monitoringEnabled = true;
+		monitoredParameter().setValue(55);
+
+		for (int i = 0; i < 4; i++) {
+			onBoardMonitoringService.checkPendingDefinitions(0);
+		}
+		CHECK(definition.checkingStatus == PMONBase::Unchecked);
+		CHECK(definition.repetitionCounter == 4);
+		CHECK(ServiceTests::count() == 0);
+
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		CHECK(definition.checkingStatus == PMONBase::AboveHighLimit);
+		CHECK(definition.repetitionCounter == 0);
+		CHECK(definition.checkTransitionList[0] == PMONBase::Unchecked);
+		CHECK(definition.checkTransitionList[1] == PMONBase::AboveHighLimit);
+
+		REQUIRE(ServiceTests::count() == 1);
+		Message report = ServiceTests::get(0);
+		CHECK(report.serviceType == EventReportService::ServiceType);
+		CHECK(report.messageType == EventReportService::LowSeverityAnomalyReport);
+		CHECK(report.read<EventDefinitionId>() == definition.aboveHighLimitEvent);
+
+		// A result that is not repeated enough times does not change the status
+		monitoredParameter().setValue(5);
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		monitoredParameter().setValue(1);
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		CHECK(definition.checkingStatus == PMONBase::AboveHighLimit);
+		CHECK(definition.repetitionCounter == 1);
+
+		// Transitions back to a nominal status do not raise an event
+		monitoredParameter().setValue(5);
+		for (int i = 0; i < 5; i++) {
+			onBoardMonitoringService.checkPendingDefinitions(0);
+		}
+		CHECK(definition.checkingStatus == PMONBase::WithinLimits);
+		CHECK(definition.checkTransitionList[0] == PMONBase::AboveHighLimit);
+		CHECK(ServiceTests::count() == 1);
+	}
+
+	SECTION("Expected value check") {
+		auto& definition = storedPMONDefinition<PMONExpectedValueCheck>(0);
+		definition.monitoringEnabled = true;
+		definition.repetitionNumber = 1;
+		definition.mask = 0x0F;
+		definition.expectedValue = 7;
+
+		monitoredParameter().setValue(0x37);
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		CHECK(definition.checkingStatus == PMONBase::ExpectedValue);
+		CHECK(ServiceTests::count() == 0);
+
+		monitoredParameter().setValue(0x38);
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		CHECK(definition.checkingStatus == PMONBase::UnexpectedValue);
+		REQUIRE(ServiceTests::count() == 1);
+		Message report = ServiceTests::get(0);
+		CHECK(report.messageType == EventReportService::InformativeEventReport);
+		CHECK(report.read<EventDefinitionId>() == definition.unexpectedValueEvent);
+	}
+
+	SECTION("Events are reported with the severity that ST[5] sets for them") {
+		auto& definition = storedPMONDefinition<PMONLimitCheck>(1);
+		definition.monitoringEnabled = true;
+		definition.repetitionNumber = 1;
+		const auto event = static_cast<EventReportService::Event>(definition.aboveHighLimitEvent);
+		REQUIRE(Services.eventReport.setEventReportType(event, EventReportService::HighSeverityAnomalyReport));
+
+		monitoredParameter().setValue(55);
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		CHECK(definition.checkingStatus == PMONBase::AboveHighLimit);
+		REQUIRE(ServiceTests::count() == 1);
+		CHECK(ServiceTests::get(0).messageType == EventReportService::HighSeverityAnomalyReport);
+		CHECK(Services.eventReport.lastHighSeverityReportID == definition.aboveHighLimitEvent);
+		CHECK(Services.eventReport.lowSeverityReportCount == 0);
+
+		Services.eventReport.setEventReportType(event, EventReportService::LowSeverityAnomalyReport);
+	}
+
+	SECTION("Delta check") {
+		auto& definition = storedPMONDefinition<PMONDeltaCheck>(2);
+		definition.monitoringEnabled = true;
+		definition.repetitionNumber = 1;
+
+		uint8_t value = 0;
+		monitoredParameter().setValue(value);
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		CHECK(definition.previousValueIsValid);
+
+		for (int i = 0; i < 4; i++) {
+			value += 20;
+			monitoredParameter().setValue(value);
+			onBoardMonitoringService.checkPendingDefinitions(0);
+		}
+		CHECK(definition.checkingStatus == PMONBase::Unchecked);
+		CHECK(definition.deltaCount == 4);
+
+		value += 20;
+		monitoredParameter().setValue(value);
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		CHECK(definition.checkingStatus == PMONBase::AboveHighThreshold);
+		CHECK(definition.deltaCount == 0);
+		CHECK(ServiceTests::count() == 1);
+		CHECK(Services.eventReport.lastLowSeverityReportID == definition.aboveHighThresholdEvent);
+
+		for (int i = 0; i < 5; i++) {
+			value += 5;
+			monitoredParameter().setValue(value);
+			onBoardMonitoringService.checkPendingDefinitions(0);
+		}
+		CHECK(definition.checkingStatus == PMONBase::WithinThreshold);
+		CHECK(ServiceTests::count() == 1);
+	}
+
+	SECTION("Monitoring interval") {
+		auto& definition = storedPMONDefinition<PMONLimitCheck>(1);
+		definition.monitoringEnabled = true;
+		definition.repetitionNumber = 1;
+		definition.monitoringInterval = 1000;
+		monitoredParameter().setValue(5);
+
+		CHECK(onBoardMonitoringService.checkPendingDefinitions(0) == 1000);
+		CHECK(definition.checkingStatus == PMONBase::WithinLimits);
+
+		monitoredParameter().setValue(55);
+		CHECK(onBoardMonitoringService.checkPendingDefinitions(500) == 500);
+		CHECK(definition.checkingStatus == PMONBase::WithinLimits);
+
+		CHECK(onBoardMonitoringService.checkPendingDefinitions(1000) == 1000);
+		CHECK(definition.checkingStatus == PMONBase::AboveHighLimit);
+
+		// Missed checks are skipped
+		CHECK(onBoardMonitoringService.checkPendingDefinitions(5000) == 1000);
+	}
+
+	SECTION("Parameter monitoring function disabled") {
+		auto& definition = storedPMONDefinition<PMONLimitCheck>(1);
+		definition.monitoringEnabled = true;
+		definition.repetitionNumber = 1;
+		onBoardMonitoringService.parameterMonitoringFunctionStatus = false;
+
+		CHECK(onBoardMonitoringService.checkPendingDefinitions(0) == std::numeric_limits<TimeStamps>::max());
+		CHECK(definition.checkingStatus == PMONBase::Unchecked);
+		CHECK(definition.repetitionCounter == 0);
+	}
+
+	monitoredParameter().setValue(initialValue);
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Check transition reports") {
+	initialiseParameterMonitoringDefinitions();
+	onBoardMonitoringService.parameterMonitoringFunctionStatus = true;
+	onBoardMonitoringService.getPMONDefinition(0).get().monitoringEnabled = false;
+	auto& definition = storedPMONDefinition<PMONLimitCheck>(1);
+	definition.monitoringEnabled = true;
+	definition.repetitionNumber = 1;
+	const uint8_t initialValue = monitoredParameter().getValue();
+
+	auto checkTransitionReports = []() {
+		uint64_t reports = 0;
+		for (uint64_t i = 0; i < ServiceTests::count(); i++) {
+			Message& message = ServiceTests::get(i);
+			reports += message.serviceType == OnBoardMonitoringService::ServiceType and
+			           message.messageType == OnBoardMonitoringService::CheckTransitionReport;
+		}
+		return reports;
+	};
+
+	SECTION("Transitions are reported immediately without a delay") {
+		monitoredParameter().setValue(55);
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		REQUIRE(checkTransitionReports() == 1);
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 0);
+
+		Message report = ServiceTests::get(1);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.read<PMONId>() == 1);
+		CHECK(report.read<ParameterId>() == 7);
+		CHECK(report.readUint8() == PMONBase::LimitCheck);
+		CHECK(report.readFloat() == Catch::Approx(definition.highLimit));
+		CHECK(report.readFloat() == Catch::Approx(55));
+		CHECK(report.readUint8() == PMONBase::Unchecked);
+		CHECK(report.readUint8() == PMONBase::AboveHighLimit);
+		CHECK(report.readDefaultCUCTimeStamp() == TimeGetter::getCurrentTimeDefaultCUC());
+	}
+
+	SECTION("Transitions are batched until the delay expires") {
+		onBoardMonitoringService.maximumTransitionReportingDelay = 10;
+		const TimeStamps delayMs = 10 * ECSSMinimumSamplingIntervalMs;
+
+		for (TimeStamps time = 0; time < 500; time += 100) {
+			monitoredParameter().setValue((time / 100) % 2 == 0 ? 55 : 5);
+			CHECK(onBoardMonitoringService.checkPendingDefinitions(time) == delayMs - time);
+		}
+		CHECK(checkTransitionReports() == 0);
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 5);
+
+		monitoredParameter().setValue(55);
+		onBoardMonitoringService.checkPendingDefinitions(delayMs);
+		CHECK(checkTransitionReports() == 1);
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 0);
+	}
+
+	SECTION("A full buffer is reported immediately, and no transition is dropped") {
+		onBoardMonitoringService.maximumTransitionReportingDelay = 1000;
+
+		for (uint8_t i = 0; i < ECSSMaxCheckTransitionsPerReport - 1; i++) {
+			monitoredParameter().setValue(i % 2 == 0 ? 55 : 5);
+			onBoardMonitoringService.checkPendingDefinitions(0);
+		}
+		CHECK(checkTransitionReports() == 0);
+		CHECK(onBoardMonitoringService.getCheckTransitionHighWaterMark() == ECSSMaxCheckTransitionsPerReport - 1);
+
+		// A single pass fills the buffer, which is reported before the next transition is stored
+		auto& deltaDefinition = storedPMONDefinition<PMONDeltaCheck>(2);
+		deltaDefinition.monitoringEnabled = true;
+		deltaDefinition.repetitionNumber = 1;
+		deltaDefinition.numberOfConsecutiveDeltaChecks = 1;
+		onBoardMonitoringService.checkPendingDefinitions(0);
+		monitoredParameter().setValue(5);
+		onBoardMonitoringService.checkPendingDefinitions(0);
+
+		REQUIRE(checkTransitionReports() == 1);
+		CHECK(onBoardMonitoringService.getCheckTransitionHighWaterMark() == ECSSMaxCheckTransitionsPerReport);
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 1);
+
+		Message report = ServiceTests::get(ServiceTests::count() - 1);
+		CHECK(report.messageType == OnBoardMonitoringService::CheckTransitionReport);
+		CHECK(report.readUint16() == ECSSMaxCheckTransitionsPerReport);
+
+		// The transition that did not fit is reported with the next TM[12,12]
+		deltaDefinition.monitoringEnabled = false;
+		onBoardMonitoringService.checkPendingDefinitions(1000 * ECSSMinimumSamplingIntervalMs);
+		REQUIRE(checkTransitionReports() == 2);
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 0);
+
+		report = ServiceTests::get(ServiceTests::count() - 1);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.read<PMONId>() == 1);
+		report.read<ParameterId>();
+		report.readUint8();
+		CHECK(report.readFloat() == Catch::Approx(definition.lowLimit));
+		CHECK(report.readFloat() == Catch::Approx(5));
+	}
+
+	monitoredParameter().setValue(initialValue);
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Add Parameter Monitoring Definitions") {
+	SECTION("Valid definitions of every check type") {
+		Message request = Message(OnBoardMonitoringService::ServiceType,
+		                          OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
+		request.appendUint16(3);
+		appendLimitCheckDefinition(request, 5, 7, -2, 8);
+		appendDeltaCheckDefinition(request, 6, 3);
+		request.append<PMONId>(7);
+		request.append<ParameterId>(4);
+		request.appendUint32(500);
+		request.appendUint16(1);
+		request.appendUint8(PMONBase::ExpectedValueCheck);
+		request.appendUint64(0xF0);
+		request.appendFloat(0x30);
+		request.append<EventDefinitionId>(5);
+
+		MessageParser::execute(request);
+		CHECK(ServiceTests::count() == 0);
+		CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 3);
+
+		auto& limitCheck = storedPMONDefinition<PMONLimitCheck>(5);
+		CHECK(limitCheck.checkType == PMONBase::LimitCheck);
+		CHECK(limitCheck.monitoredParameterId == 7);
+		CHECK(limitCheck.monitoringInterval == 1000);
+		CHECK(limitCheck.repetitionNumber == 3);
+		CHECK(limitCheck.lowLimit == -2);
+		CHECK(limitCheck.highLimit == 8);
+		CHECK(not limitCheck.monitoringEnabled);
+		CHECK(limitCheck.checkingStatus == PMONBase::Unchecked);
+
+		auto& deltaCheck = storedPMONDefinition<PMONDeltaCheck>(6);
+		CHECK(deltaCheck.checkType == PMONBase::DeltaCheck);
+		CHECK(deltaCheck.numberOfConsecutiveDeltaChecks == 4);
+		CHECK(deltaCheck.aboveHighThresholdEvent == 4);
+
+		auto& expectedValueCheck = storedPMONDefinition<PMONExpectedValueCheck>(7);
+		CHECK(expectedValueCheck.checkType == PMONBase::ExpectedValueCheck);
+		CHECK(expectedValueCheck.mask == 0xF0);
+		CHECK(expectedValueCheck.expectedValue == 0x30);
+	}
+
+	SECTION("Invalid definitions are skipped") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONLimitCheck(7, 1, 0, 1, 10, 2));
+		onBoardMonitoringService.addPMONDefinition(1, PMONLimitCheck(7, 1, 0, 1, 10, 2));
+
+		Message request = Message(OnBoardMonitoringService::ServiceType,
+		                          OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
+		request.appendUint16(7);
+		appendLimitCheckDefinition(request, 0, 7, 0, 1);
+		appendLimitCheckDefinition(request, 2, 999, 0, 1);
+		appendLimitCheckDefinition(request, 3, 7, 1, 0);
+		appendDeltaCheckDefinition(request, 4, 7);
+		appendLimitCheckDefinition(request, 5, 7, 0, 1);
+		appendLimitCheckDefinition(request, 6, 7, 0, 1);
+		request.append<PMONId>(7);
+		request.append<ParameterId>(7);
+		request.appendUint32(0);
+		request.appendUint16(1);
+		request.appendUint8(10);
+
+		MessageParser::execute(request);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::AddAlreadyExistingParameter) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::GetNonExistingParameter) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::HighLimitIsLowerThanLowLimit) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ParameterMonitoringListIsFull) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidParameterMonitoringCheckType) == 1);
+
+		CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 4);
+		CHECK(onBoardMonitoringService.hasPMONDefinition(4));
+		CHECK(onBoardMonitoringService.hasPMONDefinition(5));
+		CHECK(not onBoardMonitoringService.hasPMONDefinition(2));
+		CHECK(not onBoardMonitoringService.hasPMONDefinition(3));
+		CHECK(storedPMONDefinition<PMONLimitCheck>(0).highLimit == 10);
+	}
+
+	SECTION("Definitions raising events that do not exist are skipped") {
+		Message request = Message(OnBoardMonitoringService::ServiceType,
+		                          OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
+		request.appendUint16(3);
+		request.append<PMONId>(0);
+		request.append<ParameterId>(7);
+		request.appendUint32(0);
+		request.appendUint16(1);
+		request.appendUint8(PMONBase::ExpectedValueCheck);
+		request.appendUint64(0xFF);
+		request.appendFloat(1);
+		request.append<EventDefinitionId>(EventReportService::numberOfEvents);
+		request.append<PMONId>(1);
+		request.append<ParameterId>(7);
+		request.appendUint32(0);
+		request.appendUint16(1);
+		request.appendUint8(PMONBase::LimitCheck);
+		request.appendFloat(0);
+		request.append<EventDefinitionId>(1);
+		request.appendFloat(1);
+		request.append<EventDefinitionId>(UINT16_MAX);
+		appendLimitCheckDefinition(request, 2, 7, 0, 1);
+
+		MessageParser::execute(request);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidParameterMonitoringEventDefinition) == 2);
+		CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 1);
+		CHECK(onBoardMonitoringService.hasPMONDefinition(2));
+	}
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Delete Parameter Monitoring Definitions") {
+	initialiseParameterMonitoringDefinitions();
+
+	Message request = Message(OnBoardMonitoringService::ServiceType,
+	                          OnBoardMonitoringService::MessageType::DeleteParameterMonitoringDefinitions, Message::TC, 0);
+	request.appendUint16(3);
+	request.append<PMONId>(0);
+	request.append<PMONId>(1);
+	request.append<PMONId>(10);
+
+	MessageParser::execute(request);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidRequestToDeleteParameterMonitoringDefinition) == 1);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::GetNonExistingParameterMonitoringDefinition) == 1);
+	CHECK(onBoardMonitoringService.hasPMONDefinition(0));
+	CHECK(not onBoardMonitoringService.hasPMONDefinition(1));
+	CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 3);
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Modify Parameter Monitoring Definitions") {
+	initialiseParameterMonitoringDefinitions();
+	auto& enabledDefinition = storedPMONDefinition<PMONExpectedValueCheck>(0);
+	enabledDefinition.checkingStatus = PMONBase::UnexpectedValue;
+
+	Message request = Message(OnBoardMonitoringService::ServiceType,
+	                          OnBoardMonitoringService::MessageType::ModifyParameterMonitoringDefinitions, Message::TC, 0);
+	request.appendUint16(4);
+	appendLimitCheckDefinition(request, 0, 7, -5, 5);
+	appendDeltaCheckDefinition(request, 1, 7);
+	appendLimitCheckDefinition(request, 2, 3, 0, 1);
+	appendLimitCheckDefinition(request, 10, 7, 0, 1);
+
+	MessageParser::execute(request);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::DifferentParameterMonitoringDefinitionAndMonitoredParameter) == 1);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::ModifyParameterNotInTheParameterMonitoringList) == 1);
+
+	// The check type can be changed, while the monitoring status is kept and the checking status is reset
+	auto& modifiedDefinition = storedPMONDefinition<PMONLimitCheck>(0);
+	CHECK(modifiedDefinition.checkType == PMONBase::LimitCheck);
+	CHECK(modifiedDefinition.lowLimit == -5);
+	CHECK(modifiedDefinition.monitoringEnabled);
+	CHECK(modifiedDefinition.checkingStatus == PMONBase::Unchecked);
+	CHECK(modifiedDefinition.monitoringInterval == 1000);
+
+	CHECK(onBoardMonitoringService.getPMONDefinition(1).get().checkType == PMONBase::DeltaCheck);
+	CHECK(not onBoardMonitoringService.getPMONDefinition(1).get().monitoringEnabled);
+	CHECK(onBoardMonitoringService.getPMONDefinition(2).get().checkType == PMONBase::DeltaCheck);
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Report Parameter Monitoring Definitions") {
+	initialiseParameterMonitoringDefinitions();
+	onBoardMonitoringService.maximumTransitionReportingDelay = 7;
+
+	Message request = Message(OnBoardMonitoringService::ServiceType,
+	                          OnBoardMonitoringService::MessageType::ReportParameterMonitoringDefinitions, Message::TC, 0);
+	request.appendUint16(3);
+	request.append<PMONId>(1);
+	request.append<PMONId>(10);
+	request.append<PMONId>(2);
+
+	MessageParser::execute(request);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::ReportParameterNotInTheParameterMonitoringList) == 1);
+	REQUIRE(ServiceTests::count() == 2);
+
+	Message report = ServiceTests::get(1);
+	CHECK(report.serviceType == OnBoardMonitoringService::ServiceType);
+	CHECK(report.messageType == OnBoardMonitoringService::ParameterMonitoringDefinitionReport);
+	CHECK(report.readUint16() == 7);
+	CHECK(report.readUint16() == 2);
+
+	CHECK(report.read<PMONId>() == 1);
+	CHECK(report.read<ParameterId>() == 7);
+	CHECK(report.readBoolean() == false);
+	CHECK(report.readUint32() == 0);
+	CHECK(report.readUint16() == 5);
+	CHECK(report.readUint8() == PMONBase::LimitCheck);
+	CHECK(report.readFloat() == 2);
+	CHECK(report.read<EventDefinitionId>() == 1);
+	CHECK(report.readFloat() == 9);
+	CHECK(report.read<EventDefinitionId>() == 2);
+
+	CHECK(report.read<PMONId>() == 2);
+	CHECK(report.read<ParameterId>() == 7);
+	CHECK(report.readBoolean() == false);
+	CHECK(report.readUint32() == 0);
+	CHECK(report.readUint16() == 5);
+	CHECK(report.readUint8() == PMONBase::DeltaCheck);
+	CHECK(report.readUint16() == 5);
+	CHECK(report.readFloat() == 3);
+	CHECK(report.read<EventDefinitionId>() == 3);
+	CHECK(report.readFloat() == 11);
+	CHECK(report.read<EventDefinitionId>() == 4);
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Bulk upload of Parameter Monitoring Definitions", "[.][benchmark]") {
+	Message request = Message(OnBoardMonitoringService::ServiceType,
+	                          OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
+	request.appendUint16(ECSSMaxMonitoringDefinitions);
+	for (PMONId id = 0; id < ECSSMaxMonitoringDefinitions; id++) {
+		if (id % 2 == 0) {
+			appendLimitCheckDefinition(request, id, id, -10, 10);
+		} else {
+			appendDeltaCheckDefinition(request, id, id);
+		}
+	}
+	Message deleteAllRequest = Message(OnBoardMonitoringService::ServiceType,
+	                                   OnBoardMonitoringService::MessageType::DeleteAllParameterMonitoringDefinitions,
+	                                   Message::TC, 0);
+
+	BENCHMARK("Upload and delete a full PMON list") {
+		Message upload = request;
+		MessageParser::execute(upload);
+		const size_t uploaded = onBoardMonitoringService.getPMONDefinitionCount();
+		Message deleteAll = deleteAllRequest;
+		MessageParser::execute(deleteAll);
+		return uploaded;
+	};
+
+	CHECK(ServiceTests::count() == 0);
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Parameter Monitoring evaluation", "[.][benchmark]") {
+	const uint16_t numberOfDefinitions = 4096;
+	const uint8_t initialValue = monitoredParameter().getValue();
+
+	std::vector<PMONLimitCheck> definitions;
+	definitions.reserve(numberOfDefinitions);
+	for (uint16_t i = 0; i < numberOfDefinitions; i++) {
+		const double lowLimit = i % 128;
+		definitions.emplace_back(7, 2, lowLimit, 1, lowLimit + 64, 2);
+		definitions.back().monitoringEnabled = true;
+	}
+
+	uint8_t value = 0;
+	BENCHMARK("4096 limit checks per cycle") {
+		value += 3;
+		monitoredParameter().setValue(value);
+		uint32_t transitions = 0;
+		for (uint16_t i = 0; i < numberOfDefinitions; i++) {
+			transitions += onBoardMonitoringService.checkParameterMonitoringDefinition(i, definitions[i], 0);
+		}
+		ServiceTests::resetErrors();
+		return transitions;
+	};
+
+	monitoredParameter().setValue(initialValue);
+	ServiceTests::reset();
+}
+
+TEST_CASE("Parameter Monitoring cycles", "[.][benchmark]") {
+	const uint8_t initialValue = monitoredParameter().getValue();
+	for (PMONId id = 0; id < ECSSMaxMonitoringDefinitions; id++) {
+		PMONLimitCheck definition(7, 2, id * 10, 1, id * 10 + 64, 2);
+		definition.monitoringEnabled = true;
+		onBoardMonitoringService.addPMONDefinition(id, definition);
+	}
+	onBoardMonitoringService.parameterMonitoringFunctionStatus = true;
+
+	uint8_t value = 0;
+	BENCHMARK("Cycle over a full list of limit checks") {
+		value += 3;
+		monitoredParameter().setValue(value);
+		const TimeStamps nextWakeUp = onBoardMonitoringService.checkPendingDefinitions(0);
+		ServiceTests::resetErrors();
+		return nextWakeUp;
+	};
+
+	const PMONLimitCheck existingDefinition(7, 2, 0, 1, 64, 2);
+	BENCHMARK("Cycle over a full list of limit checks, after a change of the list") {
+		value += 3;
+		monitoredParameter().setValue(value);
+		// Adding an existing ID leaves the list as it is, but makes the batch be rebuilt like any change of the list
+		onBoardMonitoringService.addPMONDefinition(0, existingDefinition);
+		const TimeStamps nextWakeUp = onBoardMonitoringService.checkPendingDefinitions(0);
+		ServiceTests::resetErrors();
+		return nextWakeUp;
+	};
+
+	monitoredParameter().setValue(initialValue);
+	ServiceTests::reset();
+	Services.reset();
+}
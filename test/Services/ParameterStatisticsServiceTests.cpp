@@ -1,6 +1,7 @@
 #include <iostream>
 #include "ECSS_Definitions.hpp"
 #include "Message.hpp"
+#include "Parameters/PlatformParameters.hpp"
 #include "ServiceTests.hpp"
 #include "catch2/catch_all.hpp"
 
@@ -417,3 +418,247 @@ TEST_CASE("Parameter statistics definition report") {
 		ServiceTests::reset();
 	}
 }
+
+/**
+ * Adds a statistic definition for each of the given parameters, without going through TC[4,6].
+ */
+void addStatisticDefinitions(std::initializer_list<std::pair<ParameterId, SamplingInterval>> definitions) {
+	for (auto& definition: definitions) {
+		Statistic statistic;
+		statistic.setSelfSamplingInterval(definition.second);
+		Services.parameterStatistics.statisticsMap.insert({definition.first, statistic});
+	}
+}
+
+TEST_CASE("Sampling of pending statistics") {
+	auto& parameterStatistics = Services.parameterStatistics;
+
+	SECTION("Statistics are sampled at their own interval") {
+		addStatisticDefinitions({{0, 1000}, {1, 1000}, {2, 2000}});
+		parameterStatistics.setPeriodicReportingStatus(false);
+
+		CHECK(parameterStatistics.samplePendingStatistics(0) == 1000);
+		CHECK(parameterStatistics.statisticsMap[0].sampleCounter == 1);
+		CHECK(parameterStatistics.statisticsMap[1].sampleCounter == 1);
+		CHECK(parameterStatistics.statisticsMap[2].sampleCounter == 1);
+
+		CHECK(parameterStatistics.samplePendingStatistics(1000) == 1000);
+		CHECK(parameterStatistics.statisticsMap[0].sampleCounter == 2);
+		CHECK(parameterStatistics.statisticsMap[1].sampleCounter == 2);
+		CHECK(parameterStatistics.statisticsMap[2].sampleCounter == 1);
+
+		CHECK(parameterStatistics.samplePendingStatistics(1500) == 500);
+		CHECK(parameterStatistics.statisticsMap[0].sampleCounter == 2);
+
+		CHECK(parameterStatistics.samplePendingStatistics(2000) == 1000);
+		CHECK(parameterStatistics.statisticsMap[0].sampleCounter == 3);
+		CHECK(parameterStatistics.statisticsMap[2].sampleCounter == 2);
+
+		CHECK(parameterStatistics.statisticsMap[0].max == PlatformParameters::parameter1.getValue());
+		CHECK(parameterStatistics.statisticsMap[1].min == PlatformParameters::parameter2.getValue());
+		CHECK(ServiceTests::count() == 0);
+
+		ServiceTests::reset();
+	}
+
+	SECTION("Missed samples are skipped after a time jump") {
+		addStatisticDefinitions({{0, 1000}});
+		parameterStatistics.setPeriodicReportingStatus(false);
+
+		parameterStatistics.samplePendingStatistics(0);
+		CHECK(parameterStatistics.samplePendingStatistics(5300) == 1000);
+		CHECK(parameterStatistics.statisticsMap[0].sampleCounter == 2);
+
+		ServiceTests::reset();
+	}
+
+	SECTION("Periodic reports are generated at the reporting interval") {
+		addStatisticDefinitions({{0, 1000}, {1, 2000}});
+		parameterStatistics.setPeriodicReportingStatus(true);
+		REQUIRE(parameterStatistics.getReportingIntervalMs() == 700);
+
+		CHECK(parameterStatistics.samplePendingStatistics(0) == 700);
+		CHECK(ServiceTests::count() == 0);
+
+		CHECK(parameterStatistics.samplePendingStatistics(700) == 300);
+		CHECK(ServiceTests::count() == 1);
+		CHECK(ServiceTests::get(0).messageType == ParameterStatisticsService::MessageType::ParameterStatisticsReport);
+
+		CHECK(parameterStatistics.samplePendingStatistics(1000) == 400);
+		CHECK(ServiceTests::count() == 1);
+
+		CHECK(parameterStatistics.samplePendingStatistics(1400) == 600);
+		CHECK(ServiceTests::count() == 2);
+
+		ServiceTests::reset();
+	}
+
+	SECTION("Disabling the periodic reporting stops the reports") {
+		addStatisticDefinitions({{0, 1000}});
+		Message request =
+		    Message(ParameterStatisticsService::ServiceType,
+		            ParameterStatisticsService::MessageType::DisablePeriodicParameterReporting, Message::TC, 1);
+		MessageParser::execute(request);
+
+		for (TimeStamps currentTime = 0; currentTime <= 10000; currentTime += 100) {
+			parameterStatistics.samplePendingStatistics(currentTime);
+		}
+		CHECK(ServiceTests::count() == 0);
+		CHECK(parameterStatistics.statisticsMap[0].sampleCounter == 11);
+
+		ServiceTests::reset();
+	}
+
+	SECTION("New definitions are sampled on the next pass") {
+		addStatisticDefinitions({{0, 1000}});
+		parameterStatistics.setPeriodicReportingStatus(false);
+		parameterStatistics.samplePendingStatistics(0);
+
+		Message request =
+		    Message(ParameterStatisticsService::ServiceType,
+		            ParameterStatisticsService::MessageType::AddOrUpdateParameterStatisticsDefinitions, Message::TC, 1);
+		request.appendUint16(1);
+		request.append<ParameterId>(1);
+		request.append<SamplingInterval>(3000);
+		MessageParser::execute(request);
+
+		CHECK(parameterStatistics.samplePendingStatistics(200) == 800);
+		CHECK(parameterStatistics.statisticsMap[0].sampleCounter == 1);
+		CHECK(parameterStatistics.statisticsMap[1].sampleCounter == 1);
+
+		ServiceTests::reset();
+	}
+}
+
+TEST_CASE("Windowed and percentile statistics") {
+	auto& parameterStatistics = Services.parameterStatistics;
+
+	SECTION("Add definitions with accumulators") {
+		parameterStatistics.supportsStatisticsAccumulators = true;
+
+		Message request =
+		    Message(ParameterStatisticsService::ServiceType,
+		            ParameterStatisticsService::MessageType::AddOrUpdateParameterStatisticsDefinitions, Message::TC, 1);
+		request.appendUint16(4);
+		request.append<ParameterId>(0);
+		request.append<SamplingInterval>(1000);
+		request.appendUint8(8);
+		request.appendFloat(0);
+		request.appendFloat(64);
+		request.append<ParameterId>(ECSSParameterCount + 1);
+		request.append<SamplingInterval>(1000);
+		request.appendUint8(8);
+		request.appendFloat(0);
+		request.appendFloat(64);
+		request.append<ParameterId>(1);
+		request.append<SamplingInterval>(1000);
+		request.appendUint8(ECSSMaxStatisticWindowSize + 1);
+		request.appendFloat(0);
+		request.appendFloat(0);
+		request.append<ParameterId>(2);
+		request.append<SamplingInterval>(1000);
+		request.appendUint8(0);
+		request.appendFloat(10);
+		request.appendFloat(5);
+		MessageParser::execute(request);
+
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::SetNonExistingParameter) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidStatisticWindowSize) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidStatisticHistogramRange) == 1);
+		REQUIRE(parameterStatistics.statisticsMap.size() == 1);
+		CHECK(parameterStatistics.statisticsMap[0].window.getSize() == 8);
+		CHECK(parameterStatistics.statisticsMap[0].histogram.isEnabled());
+
+		ServiceTests::reset();
+	}
+
+	SECTION("Report windowed and percentile statistics") {
+		parameterStatistics.supportsStatisticsAccumulators = true;
+		Statistic statistic;
+		statistic.window.setSize(4);
+		statistic.histogram.setRange(0, 32);
+		for (double value: {30.0, 1.0, 2.0, 3.0, 4.0}) {
+			statistic.updateStatistics(value);
+		}
+		parameterStatistics.statisticsMap.insert({0, statistic});
+
+		parameterStatistics.reportParameterStatistics(false);
+		REQUIRE(ServiceTests::count() == 1);
+
+		Message report = ServiceTests::get(0);
+		report.skipBytes(2 * sizeof(TimeStamps) + sizeof(uint16_t) + sizeof(ParameterId) + sizeof(ParameterSampleCount));
+		CHECK(report.readFloat() == 30);
+		report.skipBytes(sizeof(TimeStamps));
+		CHECK(report.readFloat() == 1);
+		report.skipBytes(sizeof(TimeStamps) + 2 * sizeof(float));
+
+		CHECK(report.readUint8() == (Statistic::WindowEnabled | Statistic::HistogramEnabled));
+		CHECK(report.readUint8() == 4);
+		CHECK(report.readFloat() == 4);
+		CHECK(report.readFloat() == 1);
+		CHECK(report.readFloat() == Catch::Approx(2.5));
+		CHECK(report.readFloat() == Catch::Approx(3).margin(1));
+		CHECK(report.readFloat() == Catch::Approx(30).margin(1));
+		CHECK(report.readFloat() == Catch::Approx(30).margin(1));
+
+		ServiceTests::reset();
+	}
+
+	SECTION("Report definitions with accumulators") {
+		parameterStatistics.supportsStatisticsAccumulators = true;
+		Statistic statistic;
+		statistic.setSelfSamplingInterval(1000);
+		statistic.window.setSize(16);
+		statistic.histogram.setRange(-5, 5);
+		parameterStatistics.statisticsMap.insert({0, statistic});
+
+		parameterStatistics.statisticsDefinitionsReport();
+		REQUIRE(ServiceTests::count() == 1);
+
+		Message report = ServiceTests::get(0);
+		CHECK(report.read<SamplingInterval>() == 700);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.read<ParameterId>() == 0);
+		CHECK(report.read<SamplingInterval>() == 1000);
+		CHECK(report.readUint8() == 16);
+		CHECK(report.readFloat() == -5);
+		CHECK(report.readFloat() == 5);
+
+		ServiceTests::reset();
+	}
+}
+
+TEST_CASE("Parameter statistics sampling simulation", "[.][benchmark]") {
+	auto& parameterStatistics = Services.parameterStatistics;
+	SamplingInterval interval = 1000;
+	for (ParameterId parameterId = 0; parameterId < ECSSMaxStatisticParameters; parameterId++) {
+		addStatisticDefinitions({{parameterId, interval}});
+		interval += 250;
+	}
+	parameterStatistics.setPeriodicReportingStatus(true);
+	parameterStatistics.hasAutomaticStatisticsReset = true;
+
+	TimeStamps currentTime = 0;
+	TimeStamps simulatedDuration = 10 * 60 * 1000;
+
+	BENCHMARK("Ten simulated minutes, woken up at the returned time") {
+		TimeStamps endTime = currentTime + simulatedDuration;
+		uint32_t passes = 0;
+		while (currentTime < endTime) {
+			currentTime += parameterStatistics.samplePendingStatistics(currentTime);
+			passes++;
+		}
+		ServiceTests::resetErrors();
+		return passes;
+	};
+
+	BENCHMARK("Ten simulated minutes, woken up every 10ms") {
+		TimeStamps endTime = currentTime + simulatedDuration;
+		for (; currentTime < endTime; currentTime += 10) {
+			parameterStatistics.samplePendingStatistics(currentTime);
+		}
+		ServiceTests::resetErrors();
+	};
+
+	ServiceTests::reset();
+}
@@ -218,6 +218,28 @@ void resetAppProcessConfiguration() {
 	REQUIRE(realTimeForwarding.applicationProcessConfiguration.definitions.empty());
 }
 
+TEST_CASE("Report types of every service are known at compile time") {
+	static_assert(AllReportTypes::MessagesOfService.at(TestService::ServiceType).size() == 2);
+	static_assert(AllReportTypes::MessagesOfService.at(TestService::ServiceType).contains(TestService::MessageType::AreYouAliveTestReport));
+	static_assert(not AllReportTypes::MessagesOfService.at(TestService::ServiceType).contains(TestService::MessageType::AreYouAliveTest));
+	static_assert(AllReportTypes::MessagesOfService.at(RealTimeForwardingControlService::ServiceType).empty());
+	static_assert(AllReportTypes::MessagesOfService.at(ECSSForwardingFilterServiceTypes).empty());
+	static_assert(AllReportTypes::MessagesOfService.at(UINT8_MAX).empty());
+
+	uint8_t serviceCount = 0;
+	AllReportTypes::MessagesOfService.forEachService([&serviceCount](ServiceTypeNum serviceType) {
+		CHECK(std::find(std::begin(allServices), std::end(allServices), serviceType) != std::end(allServices));
+		serviceCount++;
+	});
+	CHECK(serviceCount == std::size(allServices));
+
+	MessageTypeNum previousMessageType = 0;
+	for (auto messageType: AllReportTypes::MessagesOfService.at(RequestVerificationService::ServiceType)) {
+		CHECK(messageType > previousMessageType);
+		previousMessageType = messageType;
+	}
+}
+
 TEST_CASE("Add report types to the Application Process Configuration") {
 	SECTION("Successful addition of report types to the Application Process Configuration") {
 		Message request(RealTimeForwardingControlService::ServiceType,
@@ -332,7 +354,7 @@ TEST_CASE("Add report types to the Application Process Configuration") {
 		realTimeForwarding.controlledApplications.push_back(applicationID);
 		validReportTypes(request);
 
-		for (auto& message: AllReportTypes::MessagesOfService.at(serviceType)) {
+		for (auto message: AllReportTypes::MessagesOfService.at(serviceType)) {
 			realTimeForwarding.applicationProcessConfiguration.definitions[std::make_pair(applicationID, serviceType)]
 			    .push_back(message);
 		}
@@ -390,6 +412,31 @@ TEST_CASE("Add report types to the Application Process Configuration") {
 		ServiceTests::reset();
 	}
 
+	SECTION("Service types beyond the report type table") {
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration,
+		                Message::TC, ApplicationId);
+
+		ApplicationProcessId applicationID = 1;
+		ServiceTypeNum serviceType = 200;
+		realTimeForwarding.controlledApplications.push_back(applicationID);
+
+		request.appendUint8(1);
+		request.append<ApplicationProcessId>(applicationID);
+		request.appendUint8(1);
+		request.append<ServiceTypeNum>(serviceType);
+		request.appendUint8(1);
+		request.append<MessageTypeNum>(1);
+
+		MessageParser::execute(request);
+
+		CHECK(ServiceTests::count() == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::MaxReportTypesReached) == 1);
+		CHECK(not realTimeForwarding.isReportTypeEnabled(1, applicationID, serviceType));
+
+		ServiceTests::reset();
+	}
+
 	SECTION("Requested addition of duplicate report type definitions") {
 		Message request(RealTimeForwardingControlService::ServiceType,
 		                RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration,
@@ -1247,7 +1294,7 @@ TEST_CASE("Report the Application Process Configuration content") {
 		for (auto appID: applications) {
 			for (auto serviceType: allServices) {
 				auto appServicePair = std::make_pair(appID, serviceType);
-				for (auto& message: AllReportTypes::MessagesOfService.at(serviceType)) {
+				for (auto message: AllReportTypes::MessagesOfService.at(serviceType)) {
 					realTimeForwarding.applicationProcessConfiguration.definitions[appServicePair].push_back(message);
 				}
 			}
@@ -1269,7 +1316,7 @@ TEST_CASE("Report the Application Process Configuration content") {
 			for (auto serviceType: allServices) {
 				REQUIRE(report.readUint8() == serviceType);
 				REQUIRE(report.readUint8() == AllReportTypes::MessagesOfService.at(serviceType).size());
-				for (auto& message: AllReportTypes::MessagesOfService.at(serviceType)) {
+				for (auto message: AllReportTypes::MessagesOfService.at(serviceType)) {
 					REQUIRE(report.readUint8() == message);
 				}
 			}
@@ -1279,3 +1326,277 @@ TEST_CASE("Report the Application Process Configuration content") {
 		Services.reset();
 	}
 }
+
+TEST_CASE("Forwarding decisions follow the Application Process Configuration") {
+	Message addRequest(RealTimeForwardingControlService::ServiceType,
+	                   RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration,
+	                   Message::TC, ApplicationId);
+	realTimeForwarding.controlledApplications.push_back(1);
+	validReportTypes(addRequest);
+	MessageParser::execute(addRequest);
+
+	CHECK(realTimeForwarding.isReportForwarded(1, HousekeepingService::ServiceType, messages1[0]));
+	CHECK(realTimeForwarding.isReportForwarded(1, EventReportService::ServiceType, messages2[1]));
+	CHECK_FALSE(realTimeForwarding.isReportForwarded(1, HousekeepingService::ServiceType, HousekeepingService::MessageType::HousekeepingParametersReport));
+	CHECK_FALSE(realTimeForwarding.isReportForwarded(1, TestService::ServiceType, TestService::MessageType::AreYouAliveTestReport));
+	CHECK_FALSE(realTimeForwarding.isReportForwarded(2, HousekeepingService::ServiceType, messages1[0]));
+	CHECK_FALSE(realTimeForwarding.isReportForwarded(1, 200, 1));
+
+	Message deleteRequest(RealTimeForwardingControlService::ServiceType,
+	                      RealTimeForwardingControlService::MessageType::DeleteReportTypesFromAppProcessConfiguration,
+	                      Message::TC, ApplicationId);
+	deleteRequest.appendUint8(1);
+	deleteRequest.append<ApplicationProcessId>(1);
+	deleteRequest.appendUint8(1);
+	deleteRequest.append<ServiceTypeNum>(HousekeepingService::ServiceType);
+	deleteRequest.appendUint8(0);
+	MessageParser::execute(deleteRequest);
+
+	CHECK_FALSE(realTimeForwarding.isReportForwarded(1, HousekeepingService::ServiceType, messages1[0]));
+	CHECK(realTimeForwarding.isReportForwarded(1, EventReportService::ServiceType, messages2[1]));
+	CHECK(ServiceTests::count() == 0);
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Reports are filtered and counted by the forwarding stage") {
+	Message housekeepingReport(HousekeepingService::ServiceType, HousekeepingService::MessageType::HousekeepingPeriodicPropertiesReport, Message::TM, 1);
+	Message testReport(TestService::ServiceType, TestService::MessageType::AreYouAliveTestReport, Message::TM, 1);
+	Message otherApplicationReport(TestService::ServiceType, TestService::MessageType::AreYouAliveTestReport, Message::TM, 2);
+
+	// Nothing is filtered while no application process is controlled
+	CHECK(realTimeForwarding.forwardReport(testReport));
+
+	Message addRequest(RealTimeForwardingControlService::ServiceType,
+	                   RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration,
+	                   Message::TC, ApplicationId);
+	realTimeForwarding.controlledApplications.push_back(1);
+	validReportTypes(addRequest);
+	MessageParser::execute(addRequest);
+
+	CHECK(realTimeForwarding.forwardReport(housekeepingReport));
+	CHECK_FALSE(realTimeForwarding.forwardReport(testReport));
+	CHECK_FALSE(realTimeForwarding.forwardReport(testReport));
+	CHECK(realTimeForwarding.forwardReport(otherApplicationReport));
+
+	auto counters = realTimeForwarding.getForwardingCounters(TestService::ServiceType, TestService::MessageType::AreYouAliveTestReport);
+	CHECK(counters.forwarded == 2);
+	CHECK(counters.dropped == 2);
+	counters = realTimeForwarding.getForwardingCounters(HousekeepingService::ServiceType, HousekeepingService::MessageType::HousekeepingPeriodicPropertiesReport);
+	CHECK(counters.forwarded == 1);
+	CHECK(counters.dropped == 0);
+	CHECK(realTimeForwarding.getForwardingCounters(EventReportService::ServiceType, EventReportService::MessageType::InformativeEventReport).forwarded == 0);
+
+	// Report types that do not fit in the counters are counted together
+	for (MessageTypeNum messageType = 0; messageType < ECSSMaxForwardingCountedReportTypes; messageType++) {
+		realTimeForwarding.forwardReport(Message(200, messageType, Message::TM, 1));
+	}
+	CHECK(realTimeForwarding.getUncountedReportTypeCounters().dropped == 2);
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Housekeeping parameter report forward control configuration") {
+	realTimeForwarding.controlledApplications.push_back(1);
+	realTimeForwarding.controlledApplications.push_back(2);
+
+	Message addRequest(RealTimeForwardingControlService::ServiceType,
+	                   RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration,
+	                   Message::TC, ApplicationId);
+	addRequest.appendUint8(3);
+	addRequest.append<ApplicationProcessId>(1);
+	addRequest.appendUint8(2);
+	addRequest.append<ParameterReportStructureId>(4);
+	addRequest.append<ParameterReportStructureId>(9);
+	addRequest.append<ApplicationProcessId>(3); // Not controlled
+	addRequest.appendUint8(1);
+	addRequest.append<ParameterReportStructureId>(4);
+	addRequest.append<ApplicationProcessId>(2);
+	addRequest.appendUint8(0); // All structures
+	MessageParser::execute(addRequest);
+
+	CHECK(ServiceTests::thrownError(ErrorHandler::NotControlledApplication));
+	auto& configuration = realTimeForwarding.housekeepingConfiguration;
+	CHECK(configuration.isEnabled(1, 4));
+	CHECK(configuration.isEnabled(1, 9));
+	CHECK_FALSE(configuration.isEnabled(1, 5));
+	CHECK_FALSE(configuration.isEnabled(3, 4));
+	CHECK(configuration.isEnabled(2, 200));
+
+	SECTION("Report the configuration") {
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::ReportHousekeepingConfigurationContent,
+		                Message::TC, ApplicationId);
+		MessageParser::execute(request);
+
+		REQUIRE(ServiceTests::count() == 2);
+		Message report = ServiceTests::get(1);
+		CHECK(report.messageType == RealTimeForwardingControlService::MessageType::HousekeepingConfigurationContentReport);
+		CHECK(report.readUint8() == 2);
+		CHECK(report.read<ApplicationProcessId>() == 1);
+		CHECK(report.readUint8() == 2);
+		CHECK(report.read<ParameterReportStructureId>() == 4);
+		CHECK(report.read<ParameterReportStructureId>() == 9);
+		CHECK(report.read<ApplicationProcessId>() == 2);
+		CHECK(report.readUint8() == 0);
+	}
+
+	SECTION("Delete structures") {
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::DeleteStructuresFromHousekeepingConfiguration,
+		                Message::TC, ApplicationId);
+		request.appendUint8(2);
+		request.append<ApplicationProcessId>(1);
+		request.appendUint8(2);
+		request.append<ParameterReportStructureId>(4);
+		request.append<ParameterReportStructureId>(5); // Not in the configuration
+		request.append<ApplicationProcessId>(2);
+		request.appendUint8(0);
+		MessageParser::execute(request);
+
+		CHECK(ServiceTests::thrownError(ErrorHandler::NonExistentForwardControlDefinition));
+		CHECK_FALSE(configuration.isEnabled(1, 4));
+		CHECK(configuration.isEnabled(1, 9));
+		CHECK_FALSE(configuration.containsApplication(2));
+
+		// Deleting the last structure of an application process deletes the application process
+		Message lastStructure(RealTimeForwardingControlService::ServiceType,
+		                      RealTimeForwardingControlService::MessageType::DeleteStructuresFromHousekeepingConfiguration,
+		                      Message::TC, ApplicationId);
+		lastStructure.appendUint8(1);
+		lastStructure.append<ApplicationProcessId>(1);
+		lastStructure.appendUint8(1);
+		lastStructure.append<ParameterReportStructureId>(9);
+		MessageParser::execute(lastStructure);
+		CHECK(configuration.size() == 0);
+	}
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Event report forward control configuration") {
+	realTimeForwarding.controlledApplications.push_back(1);
+
+	Message addRequest(RealTimeForwardingControlService::ServiceType,
+	                   RealTimeForwardingControlService::MessageType::AddEventDefinitionsToEventReportConfiguration,
+	                   Message::TC, ApplicationId);
+	addRequest.appendUint8(1);
+	addRequest.append<ApplicationProcessId>(1);
+	addRequest.appendUint8(3);
+	addRequest.append<EventDefinitionId>(EventReportService::AssertionFail);
+	addRequest.append<EventDefinitionId>(EventReportService::MCUStart);
+	addRequest.append<EventDefinitionId>(ECSSForwardControlEventDefinitions);
+	MessageParser::execute(addRequest);
+
+	CHECK(ServiceTests::thrownError(ErrorHandler::InvalidForwardControlDefinition));
+	CHECK(realTimeForwarding.eventReportConfiguration.isEnabled(1, EventReportService::AssertionFail));
+	CHECK_FALSE(realTimeForwarding.eventReportConfiguration.isEnabled(1, EventReportService::WWDGReset));
+
+	Message reportRequest(RealTimeForwardingControlService::ServiceType,
+	                      RealTimeForwardingControlService::MessageType::ReportEventReportConfigurationContent,
+	                      Message::TC, ApplicationId);
+	MessageParser::execute(reportRequest);
+	REQUIRE(ServiceTests::count() == 2);
+	Message report = ServiceTests::get(1);
+	CHECK(report.messageType == RealTimeForwardingControlService::MessageType::EventReportConfigurationContentReport);
+	CHECK(report.readUint8() == 1);
+	CHECK(report.read<ApplicationProcessId>() == 1);
+	CHECK(report.readUint8() == 2);
+	CHECK(report.read<EventDefinitionId>() == EventReportService::AssertionFail);
+	CHECK(report.read<EventDefinitionId>() == EventReportService::MCUStart);
+
+	Message deleteRequest(RealTimeForwardingControlService::ServiceType,
+	                      RealTimeForwardingControlService::MessageType::DeleteEventDefinitionsFromEventReportConfiguration,
+	                      Message::TC, ApplicationId);
+	deleteRequest.appendUint8(0); // Empty the configuration
+	MessageParser::execute(deleteRequest);
+	CHECK(realTimeForwarding.eventReportConfiguration.size() == 0);
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Housekeeping and event reports are filtered by their forward control configurations") {
+	Message addRequest(RealTimeForwardingControlService::ServiceType,
+	                   RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration,
+	                   Message::TC, ApplicationId);
+	realTimeForwarding.controlledApplications.push_back(1);
+	addRequest.appendUint8(1);
+	addRequest.append<ApplicationProcessId>(1);
+	addRequest.appendUint8(2);
+	addRequest.append<ServiceTypeNum>(HousekeepingService::ServiceType);
+	addRequest.appendUint8(0);
+	addRequest.append<ServiceTypeNum>(EventReportService::ServiceType);
+	addRequest.appendUint8(0);
+	MessageParser::execute(addRequest);
+
+	realTimeForwarding.housekeepingConfiguration.add(1, 7);
+	realTimeForwarding.eventReportConfiguration.add(1, EventReportService::MCUStart);
+
+	auto housekeepingReport = [](ParameterReportStructureId structureId) {
+		Message report(HousekeepingService::ServiceType, HousekeepingService::MessageType::HousekeepingParametersReport, Message::TM, 1);
+		report.append<ParameterReportStructureId>(structureId);
+		report.appendUint16(42);
+		return report;
+	};
+	auto eventReport = [](EventReportService::Event eventID) {
+		Message report(EventReportService::ServiceType, EventReportService::MessageType::LowSeverityAnomalyReport, Message::TM, 1);
+		report.append<EventDefinitionId>(eventID);
+		return report;
+	};
+
+	CHECK(realTimeForwarding.forwardReport(housekeepingReport(7)));
+	CHECK_FALSE(realTimeForwarding.forwardReport(housekeepingReport(8)));
+	CHECK(realTimeForwarding.forwardReport(eventReport(EventReportService::MCUStart)));
+	CHECK_FALSE(realTimeForwarding.forwardReport(eventReport(EventReportService::AssertionFail)));
+
+	// Other reports of the same services are only filtered by the application process configuration
+	CHECK(realTimeForwarding.forwardReport(Message(HousekeepingService::ServiceType, HousekeepingService::MessageType::HousekeepingStructuresReport, Message::TM, 1)));
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Forwarding decisions for 100k packets", "[.][benchmark]") {
+	Message addRequest(RealTimeForwardingControlService::ServiceType,
+	                   RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration,
+	                   Message::TC, ApplicationId);
+	for (ApplicationProcessId applicationID = 1; applicationID <= ECSSMaxControlledApplicationProcesses; applicationID++) {
+		realTimeForwarding.controlledApplications.push_back(applicationID);
+	}
+	addRequest.appendUint8(ECSSMaxControlledApplicationProcesses);
+	for (ApplicationProcessId applicationID = 1; applicationID <= ECSSMaxControlledApplicationProcesses; applicationID++) {
+		addRequest.append<ApplicationProcessId>(applicationID);
+		addRequest.appendUint8(0); // All the report types
+	}
+	MessageParser::execute(addRequest);
+
+	auto& definitions = realTimeForwarding.applicationProcessConfiguration.definitions;
+
+	BENCHMARK("Searching the configuration") {
+		size_t forwarded = 0;
+		for (uint32_t packet = 0; packet < 100000; packet++) {
+			const auto key = std::make_pair(static_cast<uint8_t>(packet % 7), allServices[packet % 10]);
+			const auto definition = definitions.find(key);
+			if (definition != definitions.end() and
+			    std::find(definition->second.begin(), definition->second.end(), packet % 11) != definition->second.end()) {
+				forwarded++;
+			}
+		}
+		return forwarded;
+	};
+
+	BENCHMARK("Compiled forwarding filter") {
+		size_t forwarded = 0;
+		for (uint32_t packet = 0; packet < 100000; packet++) {
+			forwarded += realTimeForwarding.isReportForwarded(packet % 7, allServices[packet % 10], packet % 11) ? 1 : 0;
+		}
+		return forwarded;
+	};
+
+	ServiceTests::reset();
+	Services.reset();
+}
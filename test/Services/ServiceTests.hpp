@@ -40,6 +40,16 @@ protected:
 	 */
 	static bool expectingErrors;
 
+	/**
+	 * The large packets that ST[13] has reassembled from uplinked parts, in the order they were completed
+	 */
+	static std::vector<std::vector<uint8_t>> reassembledLargePackets;
+
+	/**
+	 * Whether the test platform accepts the large packets that ST[13] reassembles
+	 */
+	static bool acceptingLargePackets;
+
 public:
 	/**
 	 * Get a message from the list of queued messages to send
@@ -56,6 +66,40 @@ public:
 		queuedMessages.push_back(message);
 	}
 
+	/**
+	 * Add a large packet to the list of packets reassembled by ST[13]
+	 * @return Whether the packet was accepted, i.e. rejectLargePackets() has not been called
+	 */
+	static bool queueLargePacket(const uint8_t* packet, size_t size) {
+		if (not acceptingLargePackets) {
+			return false;
+		}
+		reassembledLargePackets.emplace_back(packet, packet + size);
+		return true;
+	}
+
+	/**
+	 * Makes the test platform refuse the large packets that ST[13] reassembles, until the errors are reset
+	 */
+	static void rejectLargePackets() {
+		acceptingLargePackets = false;
+	}
+
+	/**
+	 * Get a large packet reassembled by ST[13]
+	 * @param number The number of the packet, starting from 0 in chronological order
+	 */
+	static const std::vector<uint8_t>& getLargePacket(uint64_t number) {
+		return reassembledLargePackets.at(number);
+	}
+
+	/**
+	 * Counts the number of large packets reassembled by ST[13]
+	 */
+	static uint64_t countLargePackets() {
+		return reassembledLargePackets.size();
+	}
+
 	/**
 	 * Add one error to the list of occurred errors.
 	 *
@@ -86,6 +130,8 @@ public:
 
 	static void resetErrors() {
 		queuedMessages.clear();
+		reassembledLargePackets.clear();
+		acceptingLargePackets = true;
 		thrownErrors.clear();
 		expectingErrors = false;
 	}
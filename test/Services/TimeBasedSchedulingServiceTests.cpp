@@ -19,18 +19,53 @@ namespace unit_test {
 		}
 
 		/*
-		 * Read the private member scheduled activities and since it is a list and it can't be
-		 * accessed, get each element and save it to a vector.
+		 * A copy of a scheduled activity, together with its request
+		 */
+		struct Activity {
+			Message request;
+			TimeBasedSchedulingService::RequestID requestID;
+			Time::DefaultCUC requestReleaseTime;
+			SubScheduleId subScheduleID;
+			ScheduleGroupId groupID;
+		};
+
+		/*
+		 * Read the private member scheduled activities, and save a copy of each of them to a
+		 * vector, in the order of their release time.
 		 */
 		static auto scheduledActivities(TimeBasedSchedulingService& tmService) {
-			std::vector<TimeBasedSchedulingService::ScheduledActivity*> listElements;
+			std::vector<Activity> listElements;
 
-			std::transform(
-			    tmService.scheduledActivities.begin(), tmService.scheduledActivities.end(),
-			    std::back_inserter(listElements), [](auto& activity) -> auto{ return &activity; });
+			for (auto slot: tmService.scheduledActivities.slotsInReleaseOrder()) {
+				const auto& activity = tmService.scheduledActivities[slot];
+				listElements.push_back({tmService.scheduledRequest(slot), activity.requestID, activity.requestReleaseTime,
+				                        activity.subScheduleID, activity.groupID});
+			}
 
 			return listElements; // Return the list elements
 		}
+
+		/*
+		 * The slots of all the scheduled activities, in the order of their release time
+		 */
+		static auto slotsInReleaseOrder(TimeBasedSchedulingService& tmService) {
+			return tmService.scheduledActivities.slotsInReleaseOrder();
+		}
+
+		/*
+		 * Change the application ID of a scheduled activity, identified by its position in the
+		 * order of release times. The activity is inserted again, so that it is indexed by its new
+		 * request identifier.
+		 */
+		static void setApplicationID(TimeBasedSchedulingService& tmService, size_t position, ApplicationProcessId applicationID) {
+			auto slot = tmService.scheduledActivities.slotsInReleaseOrder().at(position);
+			auto activity = tmService.scheduledActivities[slot];
+			tmService.scheduledActivities.erase(slot);
+
+			// The activity gets the same slot, so it keeps its stored request
+			activity.requestID.applicationID = applicationID;
+			REQUIRE(tmService.scheduledActivities.insert(activity) == slot);
+		}
 	};
 } // namespace unit_test
 
@@ -38,6 +73,30 @@ Message testMessage1, testMessage2, testMessage3, testMessage4;
 Time::DefaultCUC currentTime = TimeGetter::getCurrentTimeDefaultCUC(); // Get the current system time
 bool messagesPopulated = false;                                        // Indicate whether the test messages are initialized
 
+// Append the sub-schedule ID of a TC[11,4], if sub-schedules are enabled
+void appendSubScheduleID(Message& request, [[maybe_unused]] SubScheduleId subScheduleID = 0) {
+#if SUB_SCHEDULES_ENABLED
+	request.append<SubScheduleId>(subScheduleID);
+#endif
+}
+
+// Append the group ID of an activity of a TC[11,4], if groups are enabled
+void appendGroupID(Message& request, [[maybe_unused]] ScheduleGroupId groupID = 0) {
+#if GROUPS_ENABLED
+	request.append<ScheduleGroupId>(groupID);
+#endif
+}
+
+// Read the sub-schedule and group IDs of an activity of a TM[11,10] or TM[11,13], if they are enabled, and check them
+void checkActivityIDs(Message& report, [[maybe_unused]] SubScheduleId subScheduleID = 0, [[maybe_unused]] ScheduleGroupId groupID = 0) {
+#if SUB_SCHEDULES_ENABLED
+	CHECK(report.read<SubScheduleId>() == subScheduleID);
+#endif
+#if GROUPS_ENABLED
+	CHECK(report.read<ScheduleGroupId>() == groupID);
+#endif
+}
+
 // Run this function to set the service up before moving on with further testing
 auto activityInsertion(TimeBasedSchedulingService& timeService) {
 	if (not messagesPopulated) {
@@ -68,22 +127,27 @@ auto activityInsertion(TimeBasedSchedulingService& timeService) {
 	}
 
 	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+	appendSubScheduleID(receivedMessage);
 	receivedMessage.appendUint16(4); // Total number of requests
 	receivedMessage.sourceId = 0; // todo: proper handling of sourceID when globally integrated
 
 	// Test activity 1
+	appendGroupID(receivedMessage);
 	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 155643s);
 	receivedMessage.appendMessage(testMessage1, ECSSTCRequestStringSize);
 
 	// Test activity 2
+	appendGroupID(receivedMessage);
 	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 195723s);
 	receivedMessage.appendMessage(testMessage2, ECSSTCRequestStringSize);
 
 	// Test activity 3
+	appendGroupID(receivedMessage);
 	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 172643s);
 	receivedMessage.appendMessage(testMessage3, ECSSTCRequestStringSize);
 
 	// Test activity 4
+	appendGroupID(receivedMessage);
 	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 1724843s);
 	receivedMessage.appendMessage(testMessage4, ECSSTCRequestStringSize);
 
@@ -137,6 +201,179 @@ TEST_CASE("Execute the first activity, removes it from the list and return the r
 	REQUIRE(iterationCount == 0);
 }
 
+TEST_CASE("Execute all the due activities, up to the release budget", "[service][st11]") {
+	Services.reset();
+	activityInsertion(timeBasedService);
+
+	auto nextActivityExecutionCUCTime = timeBasedService.executeScheduledActivities(currentTime + 195723s);
+	REQUIRE(nextActivityExecutionCUCTime == currentTime + 1724843s);
+	REQUIRE(unit_test::Tester::scheduledActivities(timeBasedService).size() == 1);
+
+	nextActivityExecutionCUCTime = timeBasedService.executeScheduledActivities(currentTime + 1724843s);
+	REQUIRE(nextActivityExecutionCUCTime == Time::DefaultCUC::max());
+	REQUIRE(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+}
+
+TEST_CASE("Due activities left over by the release budget are reported as due", "[service][st11]") {
+	Services.reset();
+	activityInsertion(timeBasedService);
+
+	// The third activity is already due when the call returns
+	auto nextActivityExecutionCUCTime = timeBasedService.executeScheduledActivities(currentTime + 1724843s, 2);
+	REQUIRE(nextActivityExecutionCUCTime == currentTime + 195723s);
+	REQUIRE(unit_test::Tester::scheduledActivities(timeBasedService).size() == 2);
+
+	nextActivityExecutionCUCTime = timeBasedService.executeScheduledActivities(currentTime + 1724843s, 2);
+	REQUIRE(nextActivityExecutionCUCTime == Time::DefaultCUC::max());
+	REQUIRE(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+}
+
+TEST_CASE("A released activity can reset the schedule", "[service][st11]") {
+	Services.reset();
+	Message resetRequest(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ResetTimeBasedSchedule, Message::TC, 1);
+
+	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+	appendSubScheduleID(receivedMessage);
+	receivedMessage.appendUint16(2);
+	appendGroupID(receivedMessage);
+	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 1000s);
+	receivedMessage.appendMessage(resetRequest, ECSSTCRequestStringSize);
+	appendGroupID(receivedMessage);
+	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 1000s);
+	receivedMessage.appendMessage(resetRequest, ECSSTCRequestStringSize);
+	timeBasedService.insertActivities(receivedMessage);
+	REQUIRE(unit_test::Tester::scheduledActivities(timeBasedService).size() == 2);
+
+	auto nextActivityExecutionCUCTime = timeBasedService.executeScheduledActivities(currentTime + 1000s);
+	REQUIRE(nextActivityExecutionCUCTime == Time::DefaultCUC::max());
+	REQUIRE(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+	REQUIRE(ServiceTests::countErrors() == 0);
+}
+
+// Insert ST[17] connection tests, released one second apart, into a sub-schedule and group
+void groupInsertion(SubScheduleId subScheduleID, ScheduleGroupId groupID, uint16_t activityCount, Time::DefaultCUC releaseTime) {
+	Message connectionTest(17, 1, Message::TC, 1);
+
+	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+	appendSubScheduleID(receivedMessage, subScheduleID);
+	receivedMessage.appendUint16(activityCount);
+	for (uint16_t activity = 0; activity < activityCount; activity++) {
+		appendGroupID(receivedMessage, groupID);
+		receivedMessage.appendDefaultCUCTimeStamp(releaseTime + std::chrono::seconds(activity));
+		receivedMessage.appendMessage(connectionTest, ECSSTCRequestStringSize);
+	}
+	timeBasedService.insertActivities(receivedMessage);
+}
+
+// Send a TC[11,20], TC[11,21], TC[11,24] or TC[11,25] for a single sub-schedule or group
+void setStatus(TimeBasedSchedulingService::MessageType messageType, uint8_t id) {
+	Message request(TimeBasedSchedulingService::ServiceType, messageType, Message::TC, 1);
+	request.appendUint16(1);
+	request.appendUint8(id);
+	MessageParser::execute(request);
+}
+
+// The following tests insert activities into different sub-schedules and groups, which needs their IDs in TC[11,4]
+#if SUB_SCHEDULES_ENABLED && GROUPS_ENABLED
+TEST_CASE("TC[11,24] and TC[11,25] enable and disable groups", "[service][st11]") {
+	Services.reset();
+	groupInsertion(0, 2, 3, currentTime + 1000s);
+	groupInsertion(0, 5, 2, currentTime + 1000s);
+	REQUIRE(timeBasedService.getGroupActivityCount(2) == 3);
+	REQUIRE(timeBasedService.getGroupActivityCount(5) == 2);
+
+	setStatus(TimeBasedSchedulingService::DisableTimeBasedScheduleGroups, 2);
+	CHECK_FALSE(timeBasedService.isGroupEnabled(2));
+
+	// The disabled group does not delay the release of the other activities, and is not released
+	auto nextActivityExecutionCUCTime = timeBasedService.executeScheduledActivities(currentTime + 2000s);
+	CHECK(nextActivityExecutionCUCTime == Time::DefaultCUC::max());
+	CHECK(ServiceTests::count() == 2);
+	CHECK(timeBasedService.getGroupActivityCount(2) == 3);
+	CHECK(timeBasedService.getGroupActivityCount(5) == 0);
+
+	setStatus(TimeBasedSchedulingService::EnableTimeBasedScheduleGroups, 2);
+	nextActivityExecutionCUCTime = timeBasedService.executeScheduledActivities(currentTime + 2000s);
+	CHECK(nextActivityExecutionCUCTime == Time::DefaultCUC::max());
+	CHECK(ServiceTests::count() == 5);
+	CHECK(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+
+	setStatus(TimeBasedSchedulingService::DisableTimeBasedScheduleGroups, ECSSMaxNumberOfTimeSchedGroups);
+	CHECK(ServiceTests::thrownError(ErrorHandler::InstructionExecutionStartError));
+}
+
+TEST_CASE("TC[11,20] and TC[11,21] enable and disable sub-schedules", "[service][st11]") {
+	Services.reset();
+	setStatus(TimeBasedSchedulingService::DisableTimeBasedSubSchedules, 1);
+	CHECK_FALSE(timeBasedService.isSubScheduleEnabled(1));
+
+	// Activities are parked when they are inserted into a disabled sub-schedule
+	groupInsertion(1, 0, 2, currentTime + 1000s);
+	groupInsertion(2, 3, 1, currentTime + 1500s);
+	groupInsertion(1, 3, 1, currentTime + 1200s);
+
+	auto nextActivityExecutionCUCTime = timeBasedService.executeScheduledActivities(currentTime + 1100s);
+	CHECK(nextActivityExecutionCUCTime == currentTime + 1500s);
+	CHECK(ServiceTests::count() == 0);
+
+	// An activity is only released when both its sub-schedule and its group are enabled
+	setStatus(TimeBasedSchedulingService::DisableTimeBasedScheduleGroups, 3);
+	setStatus(TimeBasedSchedulingService::EnableTimeBasedSubSchedules, 1);
+	nextActivityExecutionCUCTime = timeBasedService.executeScheduledActivities(currentTime + 1100s);
+	CHECK(nextActivityExecutionCUCTime == Time::DefaultCUC::max());
+	CHECK(ServiceTests::count() == 2);
+
+	auto scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
+	REQUIRE(scheduledActivities.size() == 2);
+	CHECK(scheduledActivities.at(0).subScheduleID == 1);
+	CHECK(scheduledActivities.at(1).subScheduleID == 2);
+
+	setStatus(TimeBasedSchedulingService::EnableTimeBasedSubSchedules, ECSSMaxNumberOfTimeSchedSubSchedules);
+	CHECK(ServiceTests::thrownError(ErrorHandler::InstructionExecutionStartError));
+}
+
+TEST_CASE("Activities with a wrong sub-schedule or group are not inserted", "[service][st11]") {
+	Services.reset();
+	groupInsertion(ECSSMaxNumberOfTimeSchedSubSchedules, 0, 1, currentTime + 1000s);
+	CHECK(ServiceTests::thrownError(ErrorHandler::SubServiceExecutionStartError));
+
+	groupInsertion(0, ECSSMaxNumberOfTimeSchedGroups, 1, currentTime + 1000s);
+	CHECK(ServiceTests::thrownError(ErrorHandler::InstructionExecutionStartError));
+
+	CHECK(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+}
+
+TEST_CASE("Time-shift and delete the activities of a group", "[service][st11]") {
+	Services.reset();
+	groupInsertion(0, 2, 3, currentTime + 1000s);
+	groupInsertion(1, 5, 2, currentTime + 1100s);
+
+	CHECK(timeBasedService.timeShiftGroup(2, 500));
+	auto scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
+	REQUIRE(scheduledActivities.size() == 5);
+	CHECK(scheduledActivities.at(0).requestReleaseTime == currentTime + 1100s);
+	CHECK(scheduledActivities.at(1).requestReleaseTime == currentTime + 1101s);
+	CHECK(scheduledActivities.at(2).requestReleaseTime == currentTime + 1500s);
+	CHECK(scheduledActivities.at(4).requestReleaseTime == currentTime + 1502s);
+
+	// A shift that brings one activity of the group too close to the current time is rejected
+	CHECK_FALSE(timeBasedService.timeShiftGroup(2, -1450));
+	CHECK(unit_test::Tester::scheduledActivities(timeBasedService).at(2).requestReleaseTime == currentTime + 1500s);
+
+	timeBasedService.deleteGroupActivities(2);
+	CHECK(timeBasedService.getGroupActivityCount(2) == 0);
+	scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
+	REQUIRE(scheduledActivities.size() == 2);
+	CHECK(scheduledActivities.at(0).groupID == 5);
+	CHECK(scheduledActivities.at(1).groupID == 5);
+
+	// The space of the deleted activities is reused
+	groupInsertion(0, 2, 8, currentTime + 1000s);
+	CHECK(ServiceTests::hasNoErrors());
+	CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == ECSSMaxNumberOfTimeSchedActivities);
+}
+#endif
+
 TEST_CASE("TC[11,1] Enable Schedule Execution", "[service][st11]") {
 	Services.reset();
 	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::EnableTimeBasedScheduleExecutionFunction, Message::TC, 1);
@@ -159,20 +396,22 @@ TEST_CASE("TC[11,4] Activity Insertion", "[service][st11]") {
 
 	REQUIRE(scheduledActivities.size() == 4);
 
-	REQUIRE(scheduledActivities.at(0)->requestReleaseTime == currentTime + 155643s);
-	REQUIRE(scheduledActivities.at(1)->requestReleaseTime == currentTime + 172643s);
-	REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 195723s);
-	REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 1724843s);
+	REQUIRE(scheduledActivities.at(0).requestReleaseTime == currentTime + 155643s);
+	REQUIRE(scheduledActivities.at(1).requestReleaseTime == currentTime + 172643s);
+	REQUIRE(scheduledActivities.at(2).requestReleaseTime == currentTime + 195723s);
+	REQUIRE(scheduledActivities.at(3).requestReleaseTime == currentTime + 1724843s);
 
-	REQUIRE(testMessage1.bytesEqualWith(scheduledActivities.at(0)->request));
-	REQUIRE(testMessage3.bytesEqualWith(scheduledActivities.at(1)->request));
-	REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(2)->request));
-	REQUIRE(testMessage4.bytesEqualWith(scheduledActivities.at(3)->request));
+	REQUIRE(testMessage1.bytesEqualWith(scheduledActivities.at(0).request));
+	REQUIRE(testMessage3.bytesEqualWith(scheduledActivities.at(1).request));
+	REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(2).request));
+	REQUIRE(testMessage4.bytesEqualWith(scheduledActivities.at(3).request));
 
 	SECTION("Error throw test") {
 		Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+		appendSubScheduleID(receivedMessage);
 		receivedMessage.appendUint16(1); // Total number of requests
 
+		appendGroupID(receivedMessage);
 		receivedMessage.appendDefaultCUCTimeStamp(currentTime - 155643s);
 		MessageParser::execute(receivedMessage); //timeService.insertActivities(receivedMessage);
 
@@ -192,11 +431,12 @@ TEST_CASE("TC[11,15] Time shift all scheduled activities", "[service][st11]") {
 
 		CHECK(scheduledActivities.size() == 4);
 		MessageParser::execute(receivedMessage); //timeService.timeShiftAllActivities(receivedMessage);
+		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
-		REQUIRE(scheduledActivities.at(0)->requestReleaseTime == currentTime + 155643s - std::chrono::seconds(timeShift));
-		REQUIRE(scheduledActivities.at(1)->requestReleaseTime == currentTime + 172643s - std::chrono::seconds(timeShift));
-		REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 195723s - std::chrono::seconds(timeShift));
-		REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 1724843s - std::chrono::seconds(timeShift));
+		REQUIRE(scheduledActivities.at(0).requestReleaseTime == currentTime + 155643s - std::chrono::seconds(timeShift));
+		REQUIRE(scheduledActivities.at(1).requestReleaseTime == currentTime + 172643s - std::chrono::seconds(timeShift));
+		REQUIRE(scheduledActivities.at(2).requestReleaseTime == currentTime + 195723s - std::chrono::seconds(timeShift));
+		REQUIRE(scheduledActivities.at(3).requestReleaseTime == currentTime + 1724843s - std::chrono::seconds(timeShift));
 	}
 
 	SECTION("Negative Shift") {
@@ -204,10 +444,11 @@ TEST_CASE("TC[11,15] Time shift all scheduled activities", "[service][st11]") {
 
 		CHECK(scheduledActivities.size() == 4);
 		MessageParser::execute(receivedMessage); //timeService.timeShiftAllActivities(receivedMessage);
-		REQUIRE(scheduledActivities.at(0)->requestReleaseTime == currentTime + 155643s + std::chrono::seconds(timeShift));
-		REQUIRE(scheduledActivities.at(1)->requestReleaseTime == currentTime + 172643s + std::chrono::seconds(timeShift));
-		REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 195723s + std::chrono::seconds(timeShift));
-		REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 1724843s + std::chrono::seconds(timeShift));
+		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
+		REQUIRE(scheduledActivities.at(0).requestReleaseTime == currentTime + 155643s + std::chrono::seconds(timeShift));
+		REQUIRE(scheduledActivities.at(1).requestReleaseTime == currentTime + 172643s + std::chrono::seconds(timeShift));
+		REQUIRE(scheduledActivities.at(2).requestReleaseTime == currentTime + 195723s + std::chrono::seconds(timeShift));
+		REQUIRE(scheduledActivities.at(3).requestReleaseTime == currentTime + 1724843s + std::chrono::seconds(timeShift));
 	}
 
 	SECTION("Error throwing") {
@@ -215,9 +456,21 @@ TEST_CASE("TC[11,15] Time shift all scheduled activities", "[service][st11]") {
 
 		CHECK(scheduledActivities.size() == 4);
 		MessageParser::execute(receivedMessage); //timeService.timeShiftAllActivities(receivedMessage);
+		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		REQUIRE(ServiceTests::thrownError(ErrorHandler::SubServiceExecutionStartError));
 	}
+
+	SECTION("Activities of a disabled group are checked against the time margin") {
+		// All the activities are in group 0, so they are all parked
+		setStatus(TimeBasedSchedulingService::DisableTimeBasedScheduleGroups, 0);
+		receivedMessage.appendRelativeTime(-6789000);
+		MessageParser::execute(receivedMessage);
+
+		REQUIRE(ServiceTests::thrownError(ErrorHandler::SubServiceExecutionStartError));
+		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
+		REQUIRE(scheduledActivities.at(0).requestReleaseTime == currentTime + 155643s);
+	}
 }
 
 TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
@@ -225,7 +478,7 @@ TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
 	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::TimeShiftActivitiesById, Message::TC, 1);
 
 	auto scheduledActivities = activityInsertion(timeBasedService);
-	scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+	unit_test::Tester::setApplicationID(timeBasedService, 2, 4); // Append a dummy application ID
 	CHECK(scheduledActivities.size() == 4);
 
 	const Time::RelativeTime timeShift = 67890000; // Relative time-shift value
@@ -241,8 +494,8 @@ TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
 		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		// Make sure the new value is inserted sorted
-		REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 195723s + std::chrono::seconds(timeShift));
-		REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(3)->request));
+		REQUIRE(scheduledActivities.at(3).requestReleaseTime == currentTime + 195723s + std::chrono::seconds(timeShift));
+		REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(3).request));
 	}
 
 	SECTION("Negative Shift") {
@@ -256,8 +509,8 @@ TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
 		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		// Output should be sorted
-		REQUIRE(scheduledActivities.at(1)->requestReleaseTime == currentTime + 195723s - 25000s);
-		REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(1)->request));
+		REQUIRE(scheduledActivities.at(1).requestReleaseTime == currentTime + 195723s - 25000s);
+		REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(1).request));
 	}
 
 	SECTION("Error throw on wrong request ID") {
@@ -292,8 +545,9 @@ TEST_CASE("TC[11,9] Detail report scheduled activities by ID", "[service][st11]"
 	SECTION("Detailed activity report") {
 		// Verify that everything is in place
 		CHECK(scheduledActivities.size() == 4);
-		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
-		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, 0, 8); // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, 2, 4); // Append a dummy application ID
+		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		receivedMessage.appendUint16(2);                          // Two instructions in the request
 		receivedMessage.append<SourceId>(0);                           // Source ID is not implemented
@@ -314,6 +568,7 @@ TEST_CASE("TC[11,9] Detail report scheduled activities by ID", "[service][st11]"
 		uint16_t iterationCount = response.readUint16();
 		CHECK(iterationCount == 2);
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			checkActivityIDs(response);
 			Time::DefaultCUC receivedReleaseTime = response.readDefaultCUCTimeStamp();
 
 			Message receivedTCPacket;
@@ -321,11 +576,11 @@ TEST_CASE("TC[11,9] Detail report scheduled activities by ID", "[service][st11]"
 			response.readString(receivedDataStr, ECSSTCRequestStringSize);
 			receivedTCPacket = MessageParser::parseECSSTC(receivedDataStr);
 			if (i == 0) {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(0)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(0)->request);
+				REQUIRE(receivedReleaseTime == scheduledActivities.at(0).requestReleaseTime);
+				REQUIRE(receivedTCPacket == scheduledActivities.at(0).request);
 			} else {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(2)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(2)->request);
+				REQUIRE(receivedReleaseTime == scheduledActivities.at(2).requestReleaseTime);
+				REQUIRE(receivedTCPacket == scheduledActivities.at(2).request);
 			}
 		}
 	}
@@ -350,8 +605,9 @@ TEST_CASE("TM[11,10] time-based schedule detail report", "[service][st11]") {
 	SECTION("Detailed activity report") {
 		// Verify that everything is in place
 		CHECK(scheduledActivities.size() == 4);
-		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
-		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, 0, 8); // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, 2, 4); // Append a dummy application ID
+		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		receivedMessage.appendUint16(2);                          // Two instructions in the request
 		receivedMessage.append<SourceId>(0);                           // Source ID is not implemented
@@ -372,6 +628,7 @@ TEST_CASE("TM[11,10] time-based schedule detail report", "[service][st11]") {
 		uint16_t iterationCount = response.readUint16();
 		CHECK(iterationCount == 2);
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			checkActivityIDs(response);
 			Time::DefaultCUC receivedReleaseTime = response.readDefaultCUCTimeStamp();
 
 			Message receivedTCPacket;
@@ -379,11 +636,11 @@ TEST_CASE("TM[11,10] time-based schedule detail report", "[service][st11]") {
 			response.readString(receivedDataStr, ECSSTCRequestStringSize);
 			receivedTCPacket = MessageParser::parseECSSTC(receivedDataStr);
 			if (i == 0) {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(0)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(0)->request);
+				REQUIRE(receivedReleaseTime == scheduledActivities.at(0).requestReleaseTime);
+				REQUIRE(receivedTCPacket == scheduledActivities.at(0).request);
 			} else {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(2)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(2)->request);
+				REQUIRE(receivedReleaseTime == scheduledActivities.at(2).requestReleaseTime);
+				REQUIRE(receivedTCPacket == scheduledActivities.at(2).request);
 			}
 		}
 	}
@@ -398,8 +655,9 @@ TEST_CASE("TC[11,12] Summary report scheduled activities by ID", "[service][st11
 	SECTION("Summary report") {
 		// Verify that everything is in place
 		CHECK(scheduledActivities.size() == 4);
-		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
-		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, 0, 8); // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, 2, 4); // Append a dummy application ID
+		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		receivedMessage.appendUint16(2);                          // Two instructions in the request
 		receivedMessage.append<SourceId>(0);                           // Source ID is not implemented
@@ -419,21 +677,22 @@ TEST_CASE("TC[11,12] Summary report scheduled activities by ID", "[service][st11
 
 		uint16_t iterationCount = response.readUint16();
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			checkActivityIDs(response);
 			Time::DefaultCUC receivedReleaseTime = response.readDefaultCUCTimeStamp();
 			SourceId receivedSourceID = response.read<SourceId>();
 			ApplicationProcessId receivedApplicationID = response.read<ApplicationProcessId>();
 			SequenceCount receivedSequenceCount = response.read<ParameterSampleCount>();
 
 			if (i == 0) {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(0)->requestReleaseTime);
-				REQUIRE(receivedSourceID == scheduledActivities.at(0)->requestID.sourceID);
-				REQUIRE(receivedApplicationID == scheduledActivities.at(0)->requestID.applicationID);
-				REQUIRE(receivedSequenceCount == scheduledActivities.at(0)->requestID.sequenceCount);
+				REQUIRE(receivedReleaseTime == scheduledActivities.at(0).requestReleaseTime);
+				REQUIRE(receivedSourceID == scheduledActivities.at(0).requestID.sourceID);
+				REQUIRE(receivedApplicationID == scheduledActivities.at(0).requestID.applicationID);
+				REQUIRE(receivedSequenceCount == scheduledActivities.at(0).requestID.sequenceCount);
 			} else {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(2)->requestReleaseTime);
-				REQUIRE(receivedSourceID == scheduledActivities.at(2)->requestID.sourceID);
-				REQUIRE(receivedApplicationID == scheduledActivities.at(2)->requestID.applicationID);
-				REQUIRE(receivedSequenceCount == scheduledActivities.at(2)->requestID.sequenceCount);
+				REQUIRE(receivedReleaseTime == scheduledActivities.at(2).requestReleaseTime);
+				REQUIRE(receivedSourceID == scheduledActivities.at(2).requestID.sourceID);
+				REQUIRE(receivedApplicationID == scheduledActivities.at(2).requestID.applicationID);
+				REQUIRE(receivedSequenceCount == scheduledActivities.at(2).requestID.sequenceCount);
 			}
 		}
 	}
@@ -458,8 +717,9 @@ TEST_CASE("TM[11,13] time-based schedule summary report", "[service][st11]") {
 	SECTION("Summary report") {
 		// Verify that everything is in place
 		CHECK(scheduledActivities.size() == 4);
-		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
-		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, 0, 8); // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, 2, 4); // Append a dummy application ID
+		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		receivedMessage.appendUint16(2);                          // Two instructions in the request
 		receivedMessage.append<SourceId>(0);                           // Source ID is not implemented
@@ -479,21 +739,22 @@ TEST_CASE("TM[11,13] time-based schedule summary report", "[service][st11]") {
 
 		uint16_t iterationCount = response.readUint16();
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			checkActivityIDs(response);
 			Time::DefaultCUC receivedReleaseTime = response.readDefaultCUCTimeStamp();
 			SourceId receivedSourceID = response.read<SourceId>();
 			ApplicationProcessId receivedApplicationID = response.read<ApplicationProcessId>();
 			SequenceCount receivedSequenceCount = response.read<ParameterSampleCount>();
 
 			if (i == 0) {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(0)->requestReleaseTime);
-				REQUIRE(receivedSourceID == scheduledActivities.at(0)->requestID.sourceID);
-				REQUIRE(receivedApplicationID == scheduledActivities.at(0)->requestID.applicationID);
-				REQUIRE(receivedSequenceCount == scheduledActivities.at(0)->requestID.sequenceCount);
+				REQUIRE(receivedReleaseTime == scheduledActivities.at(0).requestReleaseTime);
+				REQUIRE(receivedSourceID == scheduledActivities.at(0).requestID.sourceID);
+				REQUIRE(receivedApplicationID == scheduledActivities.at(0).requestID.applicationID);
+				REQUIRE(receivedSequenceCount == scheduledActivities.at(0).requestID.sequenceCount);
 			} else {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(2)->requestReleaseTime);
-				REQUIRE(receivedSourceID == scheduledActivities.at(2)->requestID.sourceID);
-				REQUIRE(receivedApplicationID == scheduledActivities.at(2)->requestID.applicationID);
-				REQUIRE(receivedSequenceCount == scheduledActivities.at(2)->requestID.sequenceCount);
+				REQUIRE(receivedReleaseTime == scheduledActivities.at(2).requestReleaseTime);
+				REQUIRE(receivedSourceID == scheduledActivities.at(2).requestID.sourceID);
+				REQUIRE(receivedApplicationID == scheduledActivities.at(2).requestID.applicationID);
+				REQUIRE(receivedSequenceCount == scheduledActivities.at(2).requestID.sequenceCount);
 			}
 		}
 	}
@@ -515,14 +776,158 @@ TEST_CASE("TC[11,16] Detail report all scheduled activities", "[service][st11]")
 	REQUIRE(iterationCount == scheduledActivities.size());
 
 	for (uint16_t i = 0; i < iterationCount; i++) {
+		checkActivityIDs(response);
 		Time::DefaultCUC receivedReleaseTime = response.readDefaultCUCTimeStamp();
 
 		Message receivedTCPacket;
 		uint8_t receivedDataStr[ECSSTCRequestStringSize];
 		response.readString(receivedDataStr, ECSSTCRequestStringSize);
 		receivedTCPacket = MessageParser::parseECSSTC(receivedDataStr);
-		REQUIRE(receivedReleaseTime == scheduledActivities.at(i)->requestReleaseTime);
-		REQUIRE(receivedTCPacket.bytesEqualWith(scheduledActivities.at(i)->request));
+		REQUIRE(receivedReleaseTime == scheduledActivities.at(i).requestReleaseTime);
+		REQUIRE(receivedTCPacket.bytesEqualWith(scheduledActivities.at(i).request));
+	}
+}
+
+TEST_CASE("TM[11,10] and TM[11,13] are split into several reports", "[service][st11]") {
+	// The schedule cannot hold more activities than fit in a single report, so smaller reports are requested
+	Services.reset();
+	groupInsertion(0, 0, ECSSMaxNumberOfTimeSchedActivities, currentTime + 1000s);
+	const auto scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
+	REQUIRE(scheduledActivities.size() == ECSSMaxNumberOfTimeSchedActivities);
+
+	SECTION("Detail reports") {
+		const uint16_t activitiesPerReport = 4;
+		timeBasedService.timeBasedScheduleDetailReport(unit_test::Tester::slotsInReleaseOrder(timeBasedService), activitiesPerReport);
+		REQUIRE(ServiceTests::count() == (ECSSMaxNumberOfTimeSchedActivities + activitiesPerReport - 1) / activitiesPerReport);
+
+		size_t activity = 0;
+		for (size_t reportIndex = 0; reportIndex < ServiceTests::count(); reportIndex++) {
+			Message report = ServiceTests::get(reportIndex);
+			CHECK(report.messageType == TimeBasedSchedulingService::TimeBasedScheduleReportById);
+
+			const uint16_t activityCount = report.readUint16();
+			CHECK(activityCount == std::min<size_t>(activitiesPerReport, ECSSMaxNumberOfTimeSchedActivities - activity));
+			for (uint16_t i = 0; i < activityCount; i++, activity++) {
+				checkActivityIDs(report);
+				CHECK(report.readDefaultCUCTimeStamp() == scheduledActivities.at(activity).requestReleaseTime);
+				uint8_t receivedDataStr[ECSSTCRequestStringSize];
+				report.readString(receivedDataStr, ECSSTCRequestStringSize);
+				CHECK(MessageParser::parseECSSTC(receivedDataStr).bytesEqualWith(scheduledActivities.at(activity).request));
+			}
+		}
+		CHECK(activity == ECSSMaxNumberOfTimeSchedActivities);
+	}
+
+	SECTION("Summary reports") {
+		const uint16_t activitiesPerReport = 3;
+		timeBasedService.timeBasedScheduleSummaryReport(unit_test::Tester::slotsInReleaseOrder(timeBasedService), activitiesPerReport);
+		REQUIRE(ServiceTests::count() == (ECSSMaxNumberOfTimeSchedActivities + activitiesPerReport - 1) / activitiesPerReport);
+
+		size_t activity = 0;
+		for (size_t reportIndex = 0; reportIndex < ServiceTests::count(); reportIndex++) {
+			Message report = ServiceTests::get(reportIndex);
+			CHECK(report.messageType == TimeBasedSchedulingService::TimeBasedScheduledSummaryReport);
+
+			const uint16_t activityCount = report.readUint16();
+			CHECK(activityCount == std::min<size_t>(activitiesPerReport, ECSSMaxNumberOfTimeSchedActivities - activity));
+			for (uint16_t i = 0; i < activityCount; i++, activity++) {
+				checkActivityIDs(report);
+				CHECK(report.readDefaultCUCTimeStamp() == scheduledActivities.at(activity).requestReleaseTime);
+				CHECK(report.read<SourceId>() == scheduledActivities.at(activity).requestID.sourceID);
+				CHECK(report.read<ApplicationProcessId>() == scheduledActivities.at(activity).requestID.applicationID);
+				CHECK(report.read<SequenceCount>() == scheduledActivities.at(activity).requestID.sequenceCount);
+			}
+		}
+		CHECK(activity == ECSSMaxNumberOfTimeSchedActivities);
+	}
+}
+
+TEST_CASE("TC[11,11] and TC[11,14] report activities selected by a filter", "[service][st11]") {
+	Services.reset();
+	groupInsertion(0, 2, 3, currentTime + 1000s);
+	groupInsertion(1, 5, 3, currentTime + 2000s);
+	groupInsertion(1, 2, 2, currentTime + 3000s);
+
+	auto filterRequest = [](TimeBasedSchedulingService::MessageType messageType, TimeBasedSchedulingService::TimeWindowType timeWindowType) {
+		Message request(TimeBasedSchedulingService::ServiceType, messageType, Message::TC, 1);
+		request.appendEnum8(timeWindowType);
+		return request;
+	};
+
+#if SUB_SCHEDULES_ENABLED && GROUPS_ENABLED
+	SECTION("Detail report of a time window and a group") {
+		Message request = filterRequest(TimeBasedSchedulingService::DetailReportActivitiesByFilter, TimeBasedSchedulingService::FromTagToTag);
+		request.appendDefaultCUCTimeStamp(currentTime + 1001s);
+		request.appendDefaultCUCTimeStamp(currentTime + 3000s);
+		request.appendUint16(0); // All sub-schedules
+		request.appendUint16(1);
+		request.append<ScheduleGroupId>(2);
+		MessageParser::execute(request);
+
+		REQUIRE(ServiceTests::hasOneMessage());
+		Message response = ServiceTests::get(0);
+		CHECK(response.messageType == TimeBasedSchedulingService::TimeBasedScheduleReportById);
+		REQUIRE(response.readUint16() == 3);
+		for (auto releaseTime: {currentTime + 1001s, currentTime + 1002s, currentTime + 3000s}) {
+			response.read<SubScheduleId>();
+			CHECK(response.read<ScheduleGroupId>() == 2);
+			CHECK(response.readDefaultCUCTimeStamp() == releaseTime);
+			uint8_t receivedDataStr[ECSSTCRequestStringSize];
+			response.readString(receivedDataStr, ECSSTCRequestStringSize);
+		}
+	}
+
+	SECTION("Summary report of a sub-schedule after a time tag") {
+		Message request = filterRequest(TimeBasedSchedulingService::ActivitiesSummaryReportByFilter, TimeBasedSchedulingService::FromTag);
+		request.appendDefaultCUCTimeStamp(currentTime + 2001s);
+		request.appendUint16(1);
+		request.append<SubScheduleId>(1);
+		request.appendUint16(0); // All groups
+		MessageParser::execute(request);
+
+		REQUIRE(ServiceTests::hasOneMessage());
+		Message response = ServiceTests::get(0);
+		CHECK(response.messageType == TimeBasedSchedulingService::TimeBasedScheduledSummaryReport);
+		REQUIRE(response.readUint16() == 4);
+		for (auto releaseTime: {currentTime + 2001s, currentTime + 2002s, currentTime + 3000s, currentTime + 3001s}) {
+			CHECK(response.read<SubScheduleId>() == 1);
+			response.read<ScheduleGroupId>();
+			CHECK(response.readDefaultCUCTimeStamp() == releaseTime);
+			response.read<SourceId>();
+			response.read<ApplicationProcessId>();
+			response.read<SequenceCount>();
+		}
+	}
+#endif
+
+	SECTION("Summary report of everything before a time tag") {
+		Message request = filterRequest(TimeBasedSchedulingService::ActivitiesSummaryReportByFilter, TimeBasedSchedulingService::ToTag);
+		request.appendDefaultCUCTimeStamp(currentTime + 2000s);
+#if SUB_SCHEDULES_ENABLED
+		request.appendUint16(0); // All sub-schedules
+#endif
+#if GROUPS_ENABLED
+		request.appendUint16(0); // All groups
+#endif
+		MessageParser::execute(request);
+
+		REQUIRE(ServiceTests::hasOneMessage());
+		CHECK(ServiceTests::get(0).readUint16() == 4);
+	}
+
+	SECTION("Invalid time windows are rejected") {
+		Message request = filterRequest(TimeBasedSchedulingService::DetailReportActivitiesByFilter, TimeBasedSchedulingService::FromTagToTag);
+		request.appendDefaultCUCTimeStamp(currentTime + 3000s);
+		request.appendDefaultCUCTimeStamp(currentTime + 1000s);
+		MessageParser::execute(request);
+		CHECK(ServiceTests::thrownError(ErrorHandler::InvalidTimeWindow));
+
+		Message unknownWindow = filterRequest(TimeBasedSchedulingService::DetailReportActivitiesByFilter, static_cast<TimeBasedSchedulingService::TimeWindowType>(4));
+		MessageParser::execute(unknownWindow);
+		CHECK(ServiceTests::thrownError(ErrorHandler::SubServiceExecutionStartError));
+
+		// Only the two failed start of execution reports are generated
+		CHECK(ServiceTests::count() == 2);
 	}
 }
 
@@ -535,7 +940,8 @@ TEST_CASE("TC[11,5] Activity deletion by ID", "[service][st11]") {
 	SECTION("Activity deletion") {
 		// Verify that everything is in place
 		CHECK(scheduledActivities.size() == 4);
-		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, 2, 4); // Append a dummy application ID
+		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		receivedMessage.appendUint16(1);                          // Just one instruction to delete an activity
 		receivedMessage.append<SourceId>(0);                           // Source ID is not implemented
@@ -547,8 +953,8 @@ TEST_CASE("TC[11,5] Activity deletion by ID", "[service][st11]") {
 		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		REQUIRE(scheduledActivities.size() == 3);
-		REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 1724843s);
-		REQUIRE(testMessage4.bytesEqualWith(scheduledActivities.at(2)->request));
+		REQUIRE(scheduledActivities.at(2).requestReleaseTime == currentTime + 1724843s);
+		REQUIRE(testMessage4.bytesEqualWith(scheduledActivities.at(2).request));
 	}
 
 	SECTION("Error throw on wrong request ID") {